@@ -43,6 +43,8 @@ struct TextAreaProperties : WidgetProperties
             textArea->setTextSize(value.toUInt());
         else if (property == "MaximumCharacters")
             textArea->setMaximumCharacters(value.toUInt());
+        else if (property == "MaximumLines")
+            textArea->setMaximumLines(value.toUInt());
         else if (property == "ReadOnly")
             textArea->setReadOnly(parseBoolean(value, false));
         else if (property == "VerticalScrollbarPolicy")
@@ -61,6 +63,7 @@ struct TextAreaProperties : WidgetProperties
         pair.first["DefaultText"] = {"MultilineString", tgui::Serializer::serialize(textArea->getDefaultText())};
         pair.first["TextSize"] = {"UInt", tgui::String::fromNumber(textArea->getTextSize())};
         pair.first["MaximumCharacters"] = {"UInt", tgui::String::fromNumber(textArea->getMaximumCharacters())};
+        pair.first["MaximumLines"] = {"UInt", tgui::String::fromNumber(textArea->getMaximumLines())};
         pair.first["ReadOnly"] = {"Bool", tgui::Serializer::serialize(textArea->isReadOnly())};
         pair.first["VerticalScrollbarPolicy"] = {"Enum{Automatic,Always,Never}", serializeScrollbarPolicy(textArea->getVerticalScrollbarPolicy())};
         pair.first["HorizontalScrollbarPolicy"] = {"Enum{Automatic,Always,Never}", serializeScrollbarPolicy(textArea->getHorizontalScrollbarPolicy())};
@@ -225,6 +225,48 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2u getTextureSize(unsigned int characterSize) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the textures
+        ///
+        /// @return Number of texture pages, the texturePage member of each FontGlyph is smaller than this value
+        ///
+        /// Fonts that store all their glyphs in a single texture (which is the default) always return 1.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual unsigned int getTexturePageCount(unsigned int characterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that is used to store glyphs of the given character size
+        ///
+        /// @param page           Index of the texture, which has to be smaller than getTexturePageCount(characterSize)
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param textureVersion Counter that is incremented each time any of the textures is changed, returned by this function
+        ///
+        /// @return Texture to render the text glyphs with that have the given page in their texturePage member
+        ///
+        /// The default implementation calls getTexture for page 0.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getTexturePage(unsigned int page, unsigned int characterSize, unsigned int& textureVersion);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of one of the textures that is used to store glyphs of the given character size
+        ///
+        /// @param page           Index of the texture, which has to be smaller than getTexturePageCount(characterSize)
+        /// @param characterSize  Size of the characters that should be part of the texture
+        ///
+        /// @return Size of the texture that holds the glyphs
+        ///
+        /// The default implementation calls getTextureSize for page 0.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Vector2u getTexturePageSize(unsigned int page, unsigned int characterSize);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -279,6 +321,31 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::uint64_t constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks a part of the pixels as changed, so that it gets uploaded to the texture by uploadDirtyRect
+        ///
+        /// @param texture    Texture that was created from the pixels
+        /// @param dirtyRect  Part of the pixels that changed since they were last uploaded, which will be extended with rect
+        /// @param rect       Part of the pixels that was changed
+        ///
+        /// Nothing is marked when there is no texture yet, as the entire image is uploaded when the texture is created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addDirtyRect(const std::shared_ptr<BackendTexture>& texture, UIntRect& dirtyRect, UIntRect rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads the part of the pixels that changed to the texture and clears the dirty rectangle
+        ///
+        /// @param texture        Texture that was created from the pixels
+        /// @param dirtyRect      Part of the pixels that changed since they were last uploaded
+        /// @param pixels         Pixels of the entire texture
+        /// @param textureWidth   Width of the texture, which is the amount of pixels in each row of the pixels
+        /// @param bytesPerPixel  Amount of bytes that each pixel consists of
+        ///
+        /// @return False when the backend doesn't support partial updates, in which case the entire texture has to be reloaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool uploadDirtyRect(const std::shared_ptr<BackendTexture>& texture, UIntRect& dirtyRect,
+                                                   const std::uint8_t* pixels, unsigned int textureWidth, unsigned int bytesPerPixel);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -32,6 +32,9 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
+    #include <vector>
+    #include <bitset>
+    #include <array>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,6 +191,88 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2u getTextureSize(unsigned int characterSize) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are used to store the glyphs
+        ///
+        /// @param characterSize  Size of the characters that should be part of the textures (ignored, all pages are shared)
+        ///
+        /// @return Number of texture pages, the texturePage member of each FontGlyph is smaller than this value
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getTexturePageCount(unsigned int characterSize) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that is used to store glyphs
+        ///
+        /// @param page           Index of the texture, which has to be smaller than getTexturePageCount(characterSize)
+        /// @param characterSize  Size of the characters that are going to be drawn with the texture
+        /// @param textureVersion Counter that is incremented each time any of the textures is changed, returned by this function
+        ///
+        /// @return Texture to render the text glyphs with that have the given page in their texturePage member
+        ///
+        /// Calling this function marks the character size as recently used, which prevents its glyphs from being evicted.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexturePage(unsigned int page, unsigned int characterSize, unsigned int& textureVersion) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of one of the textures that is used to store glyphs
+        ///
+        /// @param page           Index of the texture, which has to be smaller than getTexturePageCount(characterSize)
+        /// @param characterSize  Size of the characters that should be part of the texture (ignored, all pages are shared)
+        ///
+        /// @return Size of the texture that holds the glyphs
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u getTexturePageSize(unsigned int page, unsigned int characterSize) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum width and height of each texture that stores the glyphs
+        ///
+        /// @param size  Maximum texture size, or 0 to use BackendRenderer::getMaximumTextureSize
+        ///
+        /// The first texture page is small, each new page is twice as large as the previous one until this size is reached.
+        /// Pages never grow once they are created. The value is always limited by the maximum texture size of the renderer.
+        /// The default size is 2048.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumTexturePageSize(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum width and height of each texture that stores the glyphs
+        ///
+        /// @return Maximum texture size, or 0 when BackendRenderer::getMaximumTextureSize is used
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumTexturePageSize() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of full texture pages after which glyphs of unused character sizes are removed
+        ///
+        /// @param count  Maximum amount of texture pages, or 0 to never evict glyphs
+        ///
+        /// When all pages are full and a new glyph doesn't fit, the glyphs of the character size that was least recently drawn
+        /// are removed from the textures to make room. Glyphs that were drawn during the current frame are never removed, when
+        /// nothing can be evicted a new page is still created. By default, glyphs are evicted once 4 pages are in use.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumTexturePageCount(unsigned int count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of full texture pages after which glyphs of unused character sizes are removed
+        ///
+        /// @return Maximum amount of texture pages, or 0 if glyphs are never evicted
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumTexturePageCount() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -218,6 +303,18 @@ TGUI_MODULE_EXPORT namespace tgui
             float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
             FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            unsigned int texturePage = 0;   //!< Index of the texture page that contains the glyph
+            unsigned int characterSize = 0; //!< Scaled character size for which the glyph was loaded
+        };
+
+        // Direct access to the glyphs of the Latin-1 range and a cache of kerning values, for a single scaled size and style
+        struct SizeCache
+        {
+            std::array<Glyph, 256> latin1Glyphs;   //!< Glyphs without outline for the first 256 code points
+            std::bitset<256> latin1GlyphsLoaded;   //!< Which elements of latin1Glyphs contain a loaded glyph
+            std::vector<float> asciiKerning;          //!< Unscaled kerning values of ASCII pairs, only allocated once needed
+            std::bitset<128 * 128> asciiKerningLoaded; //!< Which elements of asciiKerning contain a calculated value
+            std::unordered_map<std::uint64_t, float> kerning; //!< Unscaled kerning value of other pairs, keyed by their glyph indices
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,9 +328,44 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Returns the glyphs and kerning values that were already looked up for a scaled character size and style
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        TGUI_NODISCARD SizeCache& getSizeCache(unsigned int scaledCharacterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the glyph inside the font face, or 0 if the font doesn't contain the character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getGlyphIndex(char32_t codePoint) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in one of the texture pages to place the glyph
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int characterSize, unsigned int& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a new empty texture page, with a reserved square for drawing underlines in the top left corner
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTexturePage(unsigned int minimumSize = 0);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the glyphs of the least recently used character size (except the one that is passed) to free texture space
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool evictLeastRecentlyUsedCharacterSize(unsigned int characterSizeInUse);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that glyphs of the given scaled character size are being used, to prevent them from being evicted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markCharacterSizeUsed(unsigned int characterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size at which no more pixels are added to a texture page
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getTexturePageSizeLimit() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads all pixels of a page to its texture, using a single-channel texture when m_bytesPerPixel is 1
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadAtlasTexture(unsigned int page);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Sets the character size on which the freetype operations are performed
@@ -250,11 +382,23 @@ TGUI_MODULE_EXPORT namespace tgui
 
         struct Row
         {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+            Row(unsigned int rowTop, unsigned int rowHeight, unsigned int rowCharacterSize) :
+                width(0), top(rowTop), height(rowHeight), characterSize(rowCharacterSize) {}
 
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
+            unsigned int width;         //!< Current width of the row
+            unsigned int top;           //!< Y position of the row into the texture
+            unsigned int height;        //!< Height of the row
+            unsigned int characterSize; //!< Scaled character size of the glyphs in this row, 0 if the row is unused
+        };
+
+        struct TexturePage
+        {
+            std::unique_ptr<std::uint8_t[]> pixels;
+            std::shared_ptr<BackendTexture> texture;
+            unsigned int size = 0;
+            unsigned int nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
+            std::vector<Row> rows;
+            UIntRect dirtyRect; //!< Part of the pixels that changed since it was last uploaded to the texture
         };
 
         FT_Library  m_library = nullptr;  // Handle to the freetype library
@@ -267,13 +411,21 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unordered_map<unsigned int, float> m_cachedDescents;
 
         std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::unordered_map<unsigned int, std::uint64_t> m_characterSizeLastUsed; // Scaled character size mapped to m_useCounter value
+        std::uint64_t m_useCounter = 0;
+        std::uint64_t m_frameStartUseCounter = 0; // Sizes with a higher m_useCounter value were used in the current frame
+        std::uint64_t m_frameNumber = 0; // Frame number of the backend when m_frameStartUseCounter was last updated
+
+        std::unordered_map<unsigned int, SizeCache> m_sizeCaches; // Keyed by scaled character size and bold flag
+        SizeCache* m_lastSizeCache = nullptr; // Points inside m_sizeCaches, avoids the lookup when the size doesn't change
+        unsigned int m_lastSizeCacheKey = 0;
+        std::array<unsigned int, 256> m_latin1GlyphIndices = {}; // Glyph index for each of the first 256 code points
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
+        std::vector<TexturePage> m_texturePages;
+        unsigned int m_bytesPerPixel = 4; // 1 when the renderer supports alpha textures, 4 bytes with RGBA pixels otherwise
+        unsigned int m_maxTexturePageSize = 2048;
+        unsigned int m_maxTexturePageCount = 4;
         unsigned int m_textureVersion = 0;
     };
 
@@ -241,6 +241,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::shared_ptr<BackendTexture> m_texture;
         unsigned int m_textureSize = 0;
         unsigned int m_textureVersion = 0;
+        UIntRect m_dirtyRect; // Part of m_pixels that changed since it was last uploaded to m_texture
 
         std::unordered_map<unsigned int, int> m_cachedAscents;      // text size -> font ascent
         std::unordered_map<unsigned int, int> m_correctedTextSizes; // text size (ascent) -> raylib text size (ascent + descent)
@@ -258,6 +258,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::shared_ptr<BackendTexture> m_texture;
         unsigned int m_textureSize = 0;
         unsigned int m_textureVersion = 0;
+        UIntRect m_dirtyRect; // Part of m_pixels that changed since it was last uploaded to m_texture
     };
 }
 
@@ -72,6 +72,20 @@ TGUI_MODULE_EXPORT namespace tgui
         /// This maximum size is defined by the graphics driver. Most likely this will return 8192 or 16384.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual unsigned int getMaximumTextureSize() = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether textures can be created with only an alpha channel (see BackendTexture::loadAlphaTextureOnly)
+        ///
+        /// @return True if textures support loadAlphaTextureOnly, false if they only support RGBA pixels
+        ///
+        /// Fonts use this to store their glyphs with a single byte per pixel instead of 4 bytes.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool supportsAlphaTextures()
+        {
+            return false;
+        }
     };
 }
 
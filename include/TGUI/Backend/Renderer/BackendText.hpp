@@ -159,6 +159,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the information that is needed to render this text
         /// @return Data that contains the textures and vertices used by this text
+        ///
+        /// If the glyphs are spread over multiple font textures then there is a separate vertex array for each texture.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD TextVertexData getVertexData();
 
@@ -182,6 +184,11 @@ TGUI_MODULE_EXPORT namespace tgui
         void addLine(std::vector<Vertex>& vertices, float lineLength, float lineTop, const Vertex::Color& color,
                      float offset, float thickness, float outlineThickness, float fontScale);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the vertex array for glyphs on the given font texture page, creating it if needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<Vertex>& getPageVertices(std::vector<std::shared_ptr<std::vector<Vertex>>>& pages, unsigned int page);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -196,8 +203,8 @@ TGUI_MODULE_EXPORT namespace tgui
         TextStyles m_style = TextStyle::Regular;
 
         Vector2f m_size;
-        std::shared_ptr<std::vector<Vertex>> m_vertices;
-        std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_vertices; // One vertex array per font texture page
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_outlineVertices; // One vertex array per font texture page
         bool m_verticesNeedUpdate = true;
     };
 }
@@ -26,6 +26,7 @@
 #define TGUI_BACKEND_TEXTURE_HPP
 
 #include <TGUI/Font.hpp>
+#include <TGUI/Rect.hpp>
 #include <TGUI/String.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -43,6 +44,18 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Which information about the pixels is kept in memory after the texture has been loaded with the load function
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class PixelRetention
+        {
+            None,      //!< Nothing is stored, isTransparentPixel always returns false
+            AlphaMask, //!< Only 1 bit per pixel is stored to remember which pixels are transparent (nothing if the image is opaque)
+            Full       //!< A copy of all RGBA pixels is stored, which is required for getPixels to return them
+        };
+
         // Don't allow copying or moving, because we don't expect derived classes to handle it correctly
         BackendTexture(const BackendTexture&) = delete;
         BackendTexture(BackendTexture&&) = delete;
@@ -79,6 +92,40 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of each pixel will be white
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True if the texture was created, false if the backend doesn't support single-channel textures
+        ///
+        /// Once loaded, updatePixels expects 1 byte per pixel for this texture instead of 4.
+        /// Whether this function is supported can be checked with the supportsAlphaTextures function in BackendRenderer.
+        ///
+        /// @warning The pixels are never stored and isTransparentPixel thus won't work on such texture
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture, without recreating the texture
+        ///
+        /// @param region  Part of the texture to update, which has to lie completely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///                (or region.width*region.height bytes with alpha values if the texture was loaded with loadAlphaTextureOnly)
+        ///
+        /// @return True if the texture was updated, false if the texture wasn't loaded yet or if the backend doesn't support
+        ///         partial updates (in which case loadTextureOnly has to be called with the entire image instead)
+        ///
+        /// If the texture stores its pixels (i.e. it was loaded with the load function) then the stored pixels are updated too.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updatePixels(UIntRect region, const std::uint8_t* pixels);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -99,6 +146,15 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isSmooth() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture only contains an alpha channel (i.e. it was loaded with loadAlphaTextureOnly)
+        ///
+        /// @return True if the texture has a single channel, false if it contains RGBA pixels
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isAlphaTexture() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks if a certain pixel is transparent
         ///
@@ -112,15 +168,91 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Returns a pointer to the pixels (read-only)
         ///
         /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if the pixel data isn't stored.
+        ///
+        /// The pixels are only stored when the texture was loaded with the load function while its pixel retention was Full.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD const std::uint8_t* getPixels() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes which information about the pixels is kept in memory when the texture is loaded with the load function
+        ///
+        /// @param retention  What to keep after the pixels have been uploaded to the texture
+        ///
+        /// If the texture is already loaded then the stored information can only be reduced, e.g. changing the retention from
+        /// Full to AlphaMask will replace the stored pixels by a transparency mask, but not the other way around.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPixelRetention(PixelRetention retention);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns which information about the pixels is kept in memory when the texture is loaded with the load function
+        ///
+        /// @return What is kept after the pixels have been uploaded to the texture
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD PixelRetention getPixelRetention() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixel retention of textures that are created from now on
+        ///
+        /// @param retention  What newly created textures keep after their pixels have been uploaded (default is Full)
+        ///
+        /// Setting this to AlphaMask before loading images reduces the memory used by textures, but getPixels will then
+        /// return a nullptr for textures that are loaded afterwards.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDefaultPixelRetention(PixelRetention retention);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixel retention of textures that are created from now on
+        ///
+        /// @return What newly created textures keep after their pixels have been uploaded
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static PixelRetention getDefaultPixelRetention();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the pixels into the stored pixels (if there are any), called by updatePixels in derived classes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateStoredPixels(UIntRect region, const std::uint8_t* pixels);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets the stored pixels and transparency mask, called when the texture is loaded without storing its pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearStoredPixels();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores 1 bit per pixel that is set for each transparent pixel, or nothing if there are no transparent pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createTransparencyMask(const std::uint8_t* pixels);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the bits in the transparency mask for the pixels in the given region
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTransparencyMask(UIntRect region, const std::uint8_t* pixels);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::unique_ptr<std::uint8_t[]> m_transparencyMask;
+        PixelRetention m_pixelRetention = m_defaultPixelRetention;
+        PixelRetention m_storedPixels = PixelRetention::None; // What is currently stored, can be less than m_pixelRetention
         bool m_isSmooth = true;
+        bool m_isAlphaTexture = false;
+
+        static PixelRetention m_defaultPixelRetention;
     };
 }
 
@@ -90,6 +90,15 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD unsigned int getMaximumTextureSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether textures can be created with only an alpha channel (see BackendTexture::loadAlphaTextureOnly)
+        ///
+        /// @return Always returns true for this renderer
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool supportsAlphaTextures() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -31,6 +31,11 @@
     #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <array>
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -42,6 +47,18 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters about the work that was send to the GPU while drawing the last frame
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DrawStatistics
+        {
+            std::size_t drawRequests = 0; //!< Amount of times drawVertexArray was called
+            std::size_t drawCalls = 0;    //!< Amount of draw calls that were actually made to OpenGL
+            std::size_t vertices = 0;     //!< Amount of vertices that were uploaded to the GPU
+            std::size_t flushes = 0;      //!< Amount of times the batch was submitted (always 0 when batching is disabled)
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +111,39 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw calls are batched together
+        ///
+        /// @param batchingEnabled  Should vertices be recorded in a single streaming buffer instead of being drawn immediately?
+        ///
+        /// When batching is enabled, drawVertexArray applies the transform to the vertices on the CPU and appends them to a batch.
+        /// Consecutive draws that use the same texture and clipping rectangle are merged into a single draw call. The batch is
+        /// only flushed when the texture or clipping changes, or when drawGui finishes.
+        ///
+        /// Batching is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool batchingEnabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls are batched together
+        ///
+        /// @return Are vertices recorded in a single streaming buffer instead of being drawn immediately?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns counters about the draw calls that were made while drawing the last frame
+        ///
+        /// @return Statistics of the last drawGui call, or the frame that is currently being drawn when called from inside drawGui
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD DrawStatistics getDrawStatistics() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -112,6 +162,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends vertices to the batch, flushing the previous batch first if the texture or clipping changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToBatch(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                        const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the batched vertices to the streaming buffer and draws them with a single draw call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture, or the empty texture when nullptr is passed, if it isn't bound yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTexture>& texture);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -123,10 +189,25 @@ TGUI_MODULE_EXPORT namespace tgui
         std::size_t m_indexBufferSize = 0;
 
         std::unique_ptr<BackendTextureOpenGL3> m_emptyTexture;
-        std::shared_ptr<BackendTextureOpenGL3> m_currentTexture;
+        unsigned int m_currentTextureId = 0; // OpenGL texture that is currently bound while drawing
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_alphaTextureShaderUniformLocation = -1;
+        bool m_currentTextureIsAlpha = false;
+
+        bool m_batchingEnabled = false;
+        bool m_batchingActive = false; // True while drawGui is executing with batching enabled
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture; // Kept alive until the batch has been flushed
+        std::array<int, 4> m_batchScissorRect = {};
+        std::array<int, 4> m_scissorRect = {};
+        std::array<int, 4> m_appliedScissorRect = {};
+        std::size_t m_vertexBufferOffset = 0;
+        std::size_t m_indexBufferOffset = 0;
+
+        DrawStatistics m_drawStatistics;
     };
 }
 
@@ -334,12 +334,55 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unregisterSvgSprite(Sprite* sprite);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads svg images that were rasterized in the background and lets the sprites use them
+        ///
+        /// @return True if at least one texture was updated, meaning that the screen has to be redrawn
+        ///
+        /// This function is called automatically by the gui before drawing, you only need to call it yourself if you draw the
+        /// sprites differently. It does nothing unless SvgImage::setAsyncRasterizationEnabled(true) was called.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateSvgTextures();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all svg images that are being rasterized in the background are finished and uploads them
+        ///
+        /// This can be used to make sure all sprites show their final image, e.g. before taking a screenshot.
+        ///
+        /// @see SvgImage::setAsyncRasterizationEnabled
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForSvgRasterizations();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that a new frame is about to be drawn
+        ///
+        /// This function is called automatically by the gui before drawing. Fonts use it to avoid removing glyphs from their
+        /// textures while they may still be needed by the frame that is being drawn.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startFrame();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times startFrame was called
+        ///
+        /// @return Number of the frame that is currently being drawn, or 0 if no frame was drawn yet
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getFrameNumber() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_destroyOnLastGuiDetatch = false;
         String m_clipboardContents;
         float m_fontScale = 1;
+        std::uint64_t m_frameNumber = 0;
 
         std::shared_ptr<BackendRenderer> m_renderer;
         std::shared_ptr<BackendFontFactory> m_fontBackend;
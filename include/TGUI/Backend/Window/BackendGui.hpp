@@ -32,7 +32,11 @@
 #include <TGUI/TwoFingerScrollDetect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <condition_variable>
+    #include <functional>
+    #include <atomic>
     #include <chrono>
+    #include <mutex>
     #include <stack>
 #endif
 
@@ -145,9 +149,210 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return Has the event been consumed?
         ///         When this function returns false, then the event was ignored by all widgets.
+        ///
+        /// When mouse move coalescing is enabled, MouseMoved events are delayed and this function returns false for them.
+        ///
+        /// @see setMouseMoveCoalescingEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(Event event);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive mouse move events are merged before passing them to the widgets
+        ///
+        /// @param enabled  Should only the last mouse move event be handled when multiple ones arrive before the next frame?
+        ///
+        /// Mice with a high polling rate can send many mouse move events per frame. When this option is enabled, handleEvent
+        /// only stores the position of a MouseMoved event. The stored event is only passed to the widgets when a different
+        /// event is handled (so that e.g. a mouse press still happens at the correct location), when flushPendingMouseMove is
+        /// called or when the gui is drawn. The mainLoop function calls flushPendingMouseMove after all events are polled.
+        ///
+        /// Mouse move coalescing is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseMoveCoalescingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive mouse move events are merged before passing them to the widgets
+        ///
+        /// @return Is only the last mouse move event handled when multiple ones arrive before the next frame?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isMouseMoveCoalescingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the mouse move event that was delayed by the mouse move coalescing to the widgets
+        ///
+        /// @return Has the mouse move event been consumed? Returns false if there was no delayed mouse move event.
+        ///
+        /// @see setMouseMoveCoalescingEnabled
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool flushPendingMouseMove();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many mouse move events were passed to the widgets
+        ///
+        /// @return Amount of MouseMoved events that were handled since the gui was created
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getDispatchedMouseMoveCount() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many mouse move events were dropped because they were followed by another mouse move event
+        ///
+        /// @return Amount of MouseMoved events that were merged into a later one since the gui was created
+        ///
+        /// @see setMouseMoveCoalescingEnabled
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getCoalescedMouseMoveCount() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether position and size changes are propagated immediately or in a single pass before the next frame
+        ///
+        /// @param enabled  Should layouts that depend on a changed widget only be recalculated when updateLayouts is called?
+        ///
+        /// By default, changing the position or size of a widget immediately recalculates all layouts that depend on it, which
+        /// may change other widgets that then again recalculate their dependent layouts. When many widgets are changed at once
+        /// (e.g. when the window is resized or a form is loaded), the same widget can be updated many times.
+        ///
+        /// When this option is enabled, setPosition and setSize only store the new value and mark the widget as changed.
+        /// All marked widgets are processed together in updateLayouts, which is called at the start of handleEvent and draw.
+        /// Each widget is updated at most once per round of changes and containers place their auto-layouted children only once.
+        /// The onPositionChange and onSizeChange signals are also triggered by updateLayouts, only when the final value differs.
+        ///
+        /// While changes are pending, the position and size of the changed widgets are already correct, but widgets with a layout
+        /// that depends on them will still return their old values until updateLayouts is called.
+        ///
+        /// Deferred layout updates are disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeferredLayoutEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether position and size changes are propagated in a single pass before the next frame
+        ///
+        /// @return Are layouts that depend on a changed widget only recalculated when updateLayouts is called?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDeferredLayoutEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that depend on widgets that were moved or resized since the last call
+        ///
+        /// This function only does something when deferred layout updates are enabled. It is called automatically by handleEvent
+        /// and draw, but you can call it yourself when you need the final positions and sizes earlier.
+        ///
+        /// @see setDeferredLayoutEnabled
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds a widget that has deferred layout changes to the queue. You should not call this function yourself.
+        /// @return Index of the widget in the queue, which has to be passed to forgetDeferredLayoutWidget
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t queueDeferredLayoutUpdate(Widget* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds a widget that needs to trigger its position and size signals during updateLayouts. You should not call this yourself.
+        /// @return Index of the widget in the list, which has to be passed to forgetDeferredLayoutWidget
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t queueDeferredLayoutSignals(Widget* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Removes a widget from the deferred layout queues, used when the widget is destroyed or leaves the gui.
+        /// The indices are the values that were returned by queueDeferredLayoutUpdate and queueDeferredLayoutSignals.
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void forgetDeferredLayoutWidget(Widget* widget, std::size_t updateIndex, std::size_t signalsIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function to be executed on the thread that runs the gui
+        ///
+        /// @param task  Function to execute
+        ///
+        /// This is the only function of the gui that may be called from other threads. It allows worker threads to hand their
+        /// results to the gui without having to synchronize with it themselves.
+        ///
+        /// The tasks are executed in the order in which they were posted, by runPostedTasks. This function is called at the start
+        /// of updateTime, which happens in every iteration of mainLoop and in draw (unless setDrawingUpdatesTime(false) was called).
+        /// When mainLoop is waiting for events, it is woken up immediately instead of waiting until its next iteration.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the functions that were queued with the post function
+        ///
+        /// @return True if at least one task was executed
+        ///
+        /// You don't need to call this function yourself, it is called automatically by updateTime.
+        /// Tasks that are posted while the tasks are being executed will only be executed during the next call.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool runPostedTasks();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests that updateTime is called again before the given amount of time has passed
+        ///
+        /// @param delay  Time after which the gui needs to be updated
+        ///
+        /// The mainLoop function only wakes up when an event arrives or when something needs to be updated. Widgets that change
+        /// over time without receiving events (e.g. the blinking caret in a focused edit box) call this function from their
+        /// updateTime function. Requests are forgotten each time the time is updated, so they have to be repeated while needed.
+        /// Widgets whose updateTime function returns true don't need to call this, the gui is updated again in the next frame.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdate(Duration delay);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the main loop can wait for events before the gui has to be updated
+        ///
+        /// @return Time until the next timer, tool tip or requested update. An empty value if nothing needs to happen without events.
+        ///
+        /// @see scheduleUpdate
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times the main loop woke up
+        ///
+        /// @return Amount of times that mainLoop stopped waiting, because of an event, a timer, an animation or a posted task
+        ///
+        /// This can be used to verify that the gui doesn't use any cpu while it is idle.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getMainLoopWakeUpCount() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times the main loop has drawn the gui
+        ///
+        /// @return Amount of frames that were rendered by mainLoop
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getMainLoopFrameCount() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief When the tab key usage is enabled, pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -639,6 +844,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateContainerSize();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wakes up the main loop when it is waiting. Called by the post function, possibly from a different thread.
+        // Derived classes can override this to send an event that wakes up the window backend, but they must call the base class.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void wakeUpMainLoop();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sleeps until the duration has passed or until a task is posted, used by main loops that can't wait for window events
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForPostedTasks(Duration maxDuration);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long the main loop may wait for events. When the screen needs to be redrawn, it only waits until the next
+        // frame is allowed to be rendered. An empty value is returned when the main loop can wait until the next event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getMainLoopWaitTime(bool refreshRequired, std::chrono::steady_clock::time_point lastRenderTime) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -661,6 +883,17 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2i m_lastMousePos;
         TwoFingerScrollDetect m_twoFingerScroll;
 
+        bool m_mouseMoveCoalescingEnabled = false;
+        bool m_mouseMovePending = false;
+        std::uint64_t m_dispatchedMouseMoveCount = 0;
+        std::uint64_t m_coalescedMouseMoveCount = 0;
+
+        bool m_deferredLayoutEnabled = false;
+        bool m_updatingLayouts = false;
+        std::vector<Widget*> m_deferredLayoutQueue; // Entries are set to nullptr when the widget is destroyed
+        std::vector<Widget*> m_deferredLayoutBatch; // Part of the queue that is currently being processed
+        std::vector<Widget*> m_deferredLayoutSignalWidgets;
+
         Vector2i m_framebufferSize;
         RelFloatRect m_viewport{RelativeValue{0}, RelativeValue{0}, RelativeValue{1}, RelativeValue{1}};
         RelFloatRect m_view{RelativeValue{0}, RelativeValue{0}, RelativeValue{1}, RelativeValue{1}};
@@ -674,6 +907,17 @@ TGUI_MODULE_EXPORT namespace tgui
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
         std::shared_ptr<BackendRenderTarget> m_backendRenderTarget = nullptr;
+
+        std::chrono::steady_clock::time_point m_scheduledUpdateTime = std::chrono::steady_clock::time_point::max();
+        std::uint64_t m_handledEventCount = 0;
+        std::uint64_t m_mainLoopWakeUpCount = 0;
+        std::uint64_t m_mainLoopFrameCount = 0;
+
+        // Tasks posted from other threads, stored as a lock-free list in reverse order
+        struct PostedTask;
+        std::atomic<PostedTask*> m_postedTasks{nullptr};
+        std::mutex m_wakeUpMutex;
+        std::condition_variable m_wakeUpCondition;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
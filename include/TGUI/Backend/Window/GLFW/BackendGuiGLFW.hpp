@@ -254,10 +254,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateContainerSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Posts an empty event so that glfwWaitEventsTimeout returns immediately when a task was posted from another thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         GLFWwindow* m_window = nullptr;
+        bool m_redrawRequested = false; // Set when the window contents were damaged and have to be drawn again
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -163,6 +163,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void presentScreen() = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Pushes a custom event so that SDL_WaitEventTimeout returns immediately when a task was posted from another thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
 #if ((SDL_MAJOR_VERSION == 2) && (SDL_MINOR_VERSION < 26))
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Updates m_framebufferSize by calling an equivalent of SDL_GetRendererOutputSize, depending on the renderer
@@ -183,6 +188,8 @@ TGUI_MODULE_EXPORT namespace tgui
         SDL_FingerID m_touchFirstFingerId = 0;      // Only valid if m_touchFirstFingerDown is true
         SDL_TouchID  m_touchFirstFingerTouchId = 0; // Only valid if m_touchFirstFingerDown is true
 
+        std::atomic<std::uint32_t> m_wakeUpEventType{0}; // Only set while mainLoop is running
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 }
@@ -112,6 +112,7 @@ TGUI_MODULE_EXPORT namespace tgui
         void sortWidgets(Function&& function)
         {
             std::sort(m_widgets.begin(), m_widgets.end(), std::forward<Function>(function));
+            invalidateSpatialIndex();
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +367,41 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Widget::Ptr getWidgetAtPos(Vector2f pos, bool recursive) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @param enabled  Should the child widgets be stored in a grid based on their bounding box?
+        ///
+        /// Without the index, every mouse event checks all child widgets until the widget below the mouse is found.
+        /// Enabling the index is useful for containers with a large amount of children, as then only the widgets whose bounding
+        /// box contains the mouse have to be checked. The index is rebuilt lazily when a child widget was moved or resized.
+        ///
+        /// Rotated and scaled widgets are always checked. Other widgets are only found when the mouse is inside the area
+        /// described by their position, size, widget offset and full size. If the full size of a widget changes without its
+        /// size changing (e.g. when changing the text of a radio button), then invalidateSpatialIndex has to be called.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Are the child widgets stored in a grid based on their bounding box?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSpatialIndexEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the spatial index as outdated, causing it to be rebuilt the next time the mouse moves
+        ///
+        /// Child widgets call this function automatically when their position, size, origin, scale or rotation changes.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateSpatialIndex();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -542,11 +578,17 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is used to reposition and resize widgets that have an AutoSize other than Manual
+        /// This function is used to reposition and resize widgets that have an AutoSize other than Manual.
+        /// When the gui has deferred layout updates enabled, the widgets are only placed in the next BackendGui::updateLayouts call.
         /// @since TGUI 1.1
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateChildrenWithAutoLayout();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDeferredLayout() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -607,6 +649,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2f transformMousePos(const Widget::Ptr& widget, Vector2f mousePos) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the indices of the child widgets that might be located at the position, sorted from back to front.
+        // This function should only be called when the spatial index is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<std::size_t>& getSpatialIndexCandidates(Vector2f pos) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Finishes adding a widget to the container
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,6 +688,38 @@ TGUI_MODULE_EXPORT namespace tgui
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the child widgets in a grid of cells based on their bounding boxes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions and resizes the widgets that have an AutoSize other than Manual, without waiting for the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void placeChildrenWithAutoLayout();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        bool m_spatialIndexEnabled = false;
+
+        // The spatial index is a uniform grid, where each cell stores the indices of the widgets that overlap with it.
+        // The indices of the widgets in cell i are found in m_spatialIndexCellWidgets between m_spatialIndexCellStarts[i]
+        // and m_spatialIndexCellStarts[i+1]. Rotated and scaled widgets are stored separately as they are always checked.
+        mutable bool m_spatialIndexValid = false;
+        mutable std::size_t m_spatialIndexWidgetCount = 0;
+        mutable FloatRect m_spatialIndexBounds;
+        mutable float m_spatialIndexCellSize = 1;
+        mutable std::size_t m_spatialIndexColumns = 0;
+        mutable std::size_t m_spatialIndexRows = 0;
+        mutable std::vector<std::size_t> m_spatialIndexCellStarts;
+        mutable std::vector<std::size_t> m_spatialIndexCellWidgets;
+        mutable std::vector<std::size_t> m_spatialIndexUnboundedWidgets;
+        mutable std::vector<std::size_t> m_spatialIndexCandidates;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
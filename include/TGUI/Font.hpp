@@ -49,6 +49,7 @@ TGUI_MODULE_EXPORT namespace tgui
         float     advance = 0;  //!< Offset to move horizontally to the next character
         FloatRect bounds;       //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
         UIntRect  textureRect;  //!< Texture coordinates of the glyph inside the font's texture
+        unsigned int texturePage = 0; //!< Index of the font texture that contains the glyph (see BackendFont::getTexturePage)
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
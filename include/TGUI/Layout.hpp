@@ -267,6 +267,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses a trimmed and non-empty expression string. The constructor only calls this when the string wasn't parsed before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseExpression(const String& expression);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // If a widget is bound, inform it that the layout no longer binds it
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/String.hpp>
+#include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Optional.hpp>
+#include <TGUI/Rect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <sstream>
@@ -79,16 +82,45 @@ TGUI_MODULE_EXPORT namespace tgui
             String name;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Value that was already deserialized before it was stored in the binary format
+        ///
+        /// Textures and fonts keep their filename in the value member of the value node, so that the path of the file can still
+        /// be placed in front of it. They are only loaded when createObjectConverter is called.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TypedValue
+        {
+            ObjectConverter::Type type = ObjectConverter::Type::None;
+            ObjectConverter value;
+            UIntRect texturePartRect;
+            UIntRect textureMiddleRect;
+            Optional<bool> textureSmooth;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Widget file value node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         struct ValueNode
         {
             ValueNode(String v = U"") : value(std::move(v)) {}
+            ValueNode(ValueNode&&) = default;
+            ValueNode& operator=(const ValueNode&) = delete; // Not implemented because current code has no use for it
+            ValueNode& operator=(ValueNode&&) = default;
+
+            ValueNode(const ValueNode& other) :
+                value{other.value},
+                listNode{other.listNode},
+                valueList{other.valueList},
+                typed{other.typed ? std::make_unique<TypedValue>(*other.typed) : nullptr}
+            {
+            }
 
             String value;
             bool listNode = false;
             std::vector<String> valueList;
+            std::unique_ptr<TypedValue> typed; // Only set for values in the binary format, nullptr when the value only exists as text
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +132,48 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<Node> parse(std::stringstream& stream);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is already stored in memory
+        ///
+        /// @param data  Contents of the widget file, e.g. the bytes of a file that was read into memory
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// This function doesn't need to copy the data into a stream first, which makes it faster than the other overload.
+        /// The data can either be text or the binary format that is created by the emitBinary function.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parse(CharStringView data);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in a binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be stored
+        /// @param stream   Stream to which the binary data will be added
+        ///
+        /// The binary data can be passed to the parse function (or be stored in a form or theme file) instead of the text format.
+        /// Reading the binary format doesn't require tokenizing text, the nodes and values are copied directly from the data.
+        /// Value nodes that contain a typed value are stored with a type tag and their raw value. The renderer sections of a form
+        /// (nodes called "Renderer" or starting with "Renderer.") are deserialized before they are stored, so loading the form
+        /// gives the renderers colors, numbers, outlines, text styles, textures and fonts that don't need to be deserialized.
+        /// Widget properties outside the renderer sections are stored as text and are deserialized by the widgets.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data is in the binary format that is created by emitBinary
+        ///
+        /// @param data  Contents of a widget or theme file
+        ///
+        /// @return True if the data starts with the header of the binary format, false if it should be parsed as text
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isBinary(CharStringView data);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -107,6 +181,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param stream   Stream to which the widget file will be added
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a node as it would be written in the text format
+        ///
+        /// @param valueNode  Value node that either contains text or a typed value that was read from the binary format
+        ///
+        /// @return Text of the value, typed values are serialized
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static String serializeValue(const ValueNode& valueNode);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the object that is stored in renderers from a value node
+        ///
+        /// @param valueNode  Value node that either contains text or a typed value that was read from the binary format
+        ///
+        /// @return Typed value, or the text that will be deserialized when the renderer requests it with a specific type
+        ///
+        /// Textures and fonts that were stored in the binary format are loaded by this function.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static ObjectConverter createObjectConverter(const ValueNode& valueNode);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
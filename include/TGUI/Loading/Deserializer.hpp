@@ -26,6 +26,8 @@
 #define TGUI_DESERIALIZER_HPP
 
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Optional.hpp>
+#include <TGUI/Rect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
@@ -53,6 +55,21 @@ TGUI_MODULE_EXPORT namespace tgui
     public:
         TGUI_NODISCARD static std::vector<String> split(const String& str, char delim);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits a serialized texture into its filename and parameters, without loading the image
+        ///
+        /// @param value       Serialized texture, e.g. "image.png" Part(0, 0, 50, 50) Smooth
+        /// @param filename    Filename of the image, or the embedded image data if it starts with "data:". Empty for "None".
+        /// @param partRect    Part rectangle, or an empty rectangle if it wasn't specified
+        /// @param middleRect  Middle rectangle, or an empty rectangle if it wasn't specified
+        /// @param smooth      Whether Smooth or NoSmooth was specified, or an empty value if the default should be used
+        ///
+        /// @exception Exception when the value isn't a valid texture
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void splitTexture(const String& value, String& filename, UIntRect& partRect, UIntRect& middleRect, Optional<bool>& smooth);
+
     private:
         static std::unordered_map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
     };
@@ -27,6 +27,7 @@
 
 #include <TGUI/String.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/ObjectConverter.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <memory>
@@ -82,6 +83,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual const std::map<String, String>& load(const String& primary, const String& secondary) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme as the values that are stored in renderers
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation calls the load function and stores the text of each value, which gets deserialized when
+        /// the renderer requests the value. Loaders that already have typed values can return them here instead.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::map<String, ObjectConverter> loadValues(const String& primary, const String& secondary);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Check if the requested property-value pairs are available
         ///
@@ -155,6 +171,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD const std::map<String, String>& load(const String& filename, const String& section) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as the values that are stored in renderers
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Values from a theme that was compiled with compileToBinary are returned without deserializing any text.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::map<String, ObjectConverter> loadValues(const String& filename, const String& section) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Check if the requested property-value pairs are available
         ///
@@ -176,6 +209,26 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void flushCache(const String& filename = "");
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a theme file into the binary format, which can be read without tokenizing the text of the file
+        ///
+        /// @param filename  Filename of the theme file to compile
+        /// @param stream    Stream to which the binary data will be written
+        ///
+        /// References to other sections are already resolved and the values of the renderer properties are stored already
+        /// deserialized, so loading the compiled theme with loadValues (which is what Theme uses) doesn't deserialize any text.
+        /// The written data should be stored in a file, which can then be loaded in the same way as the original theme file.
+        /// Textures and fonts are stored as their filename and parameters, they are loaded when the renderer is created.
+        ///
+        /// Values are deserialized with the functions that are set in the Deserializer at the moment this function is called.
+        /// Global properties, properties of which the type isn't known and outlines with relative values remain text.
+        ///
+        /// @exception Exception when the file couldn't be read or when finding syntax errors in the file
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compileToBinary(const String& filename, std::stringstream& stream);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -188,10 +241,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual std::unique_ptr<DataIO::Node> readFile(const String& filename) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads and parses the file without changing the paths of textures and fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<DataIO::Node> readFileWithoutPath(const String& filename);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
         static std::map<String, std::map<String, std::map<String, String>>> m_propertiesCache;
         static std::map<String, std::map<String, String>> m_globalPropertiesCache;
+        static std::map<String, std::map<String, std::unique_ptr<DataIO::Node>>> m_sectionsCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
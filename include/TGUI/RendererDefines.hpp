@@ -29,7 +29,15 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Registers the type of the property, so that its value can be deserialized when a form or theme is stored in the binary format
+#define TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, TYPE) \
+    static const bool tguiRendererPropertyTypeRegistered_##CLASS##_##NAME = \
+        tgui::RendererData::registerPropertyType(#NAME, tgui::ObjectConverter::Type::TYPE);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, Outline) \
     tgui::Outline CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
@@ -46,6 +54,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, Color) \
     tgui::Color CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
@@ -62,6 +71,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, TextStyle) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
@@ -78,6 +88,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, Number) \
     float CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
@@ -97,6 +108,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, Bool) \
     bool CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
@@ -116,6 +128,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
+    TGUI_RENDERER_PROPERTY_TYPE(CLASS, NAME, Texture) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
         const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
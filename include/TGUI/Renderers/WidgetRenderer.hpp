@@ -55,6 +55,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
+        /// @internal
+        /// Deserializes the values of the known renderer properties in the node and its nested sections, so that they can be
+        /// stored as typed values in the binary format. Values of unknown properties and invalid values are left as text.
+        static void deserializeDataIONodeValues(DataIO::Node& rendererNode);
+
+        /// @internal
+        /// Stores the type of a renderer property. This is done by the TGUI_RENDERER_PROPERTY_* macros that define the property.
+        /// If properties with the same name have different types then the type is unknown and their values are kept as text.
+        /// @return Always true, so that the result can be used to initialize a static variable
+        static bool registerPropertyType(const char* property, ObjectConverter::Type type);
+
+        /// @internal
+        /// Returns the type with which the property was registered, or None if the type isn't known.
+        TGUI_NODISCARD static ObjectConverter::Type getPropertyType(const String& property);
+
         std::map<String, ObjectConverter> propertyValuePairs;
         std::unordered_set<Widget*> observers;
         Theme* connectedTheme = nullptr;
@@ -69,16 +69,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
+        /// @param name             Name of the signal, the string literal is referenced without being copied
         /// @param extraParameters  Amount of extra parameters to reserve space for
+        ///
+        /// The character array must remain valid as long as the signal exists. Names that are created at runtime should be
+        /// passed as a String instead.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(String&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+        template <std::size_t N>
+        Signal(const char (&name)[N], std::size_t extraParameters = 0) :
+            m_name{name}
         {
             if (1 + extraParameters > m_parameters.size())
                 m_parameters.resize(1 + extraParameters);
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param name             Name of the signal
+        /// @param extraParameters  Amount of extra parameters to reserve space for
+        ///
+        /// Names that aren't string literals are copied into a global table that stores each distinct name once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal(String&& name, std::size_t extraParameters = 0);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Copy constructor which will not copy the signal handlers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,17 +138,14 @@ TGUI_MODULE_EXPORT namespace tgui
         template <typename Func, typename... BoundArgs, typename std::enable_if_t<std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value>* = nullptr>
         unsigned int connect(const Func& func, const BoundArgs&... args)
         {
-            const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                return addHandler(std::function<void()>(func));
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                return addHandler([=]{ invokeFunc(func, args...); });
             }
-
-            return id;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,7 +160,7 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int connectEx(const Func& func, const BoundArgs&... args)
         {
             // The name is copied so that the lambda does not depend on the 'this' pointer
-            return connect([func, name=m_name, args...](){ invokeFunc(func, args..., getWidget(), name); });
+            return connect([func, name=String{m_name}, args...](){ invokeFunc(func, args..., getWidget(), name); });
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,7 +193,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD String getName() const
         {
-            return m_name;
+            return String{m_name};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,9 +222,34 @@ TGUI_MODULE_EXPORT namespace tgui
             return m_enabled;
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are signal handlers connected to the signal
+        ///
+        /// @return Is at least one handler connected?
+        ///
+        /// This can be used to skip preparing the parameters of the signal when nobody is interested in them. When a handler
+        /// disconnects the last handler while the signal is being emitted, this keeps returning true until the next emit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasHandlers() const
+        {
+            return m_handlers != nullptr; // The handler list is released when the last handler is disconnected
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores a signal handler and returns the unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()>&& handler);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases the handler list when no handlers are left in it and the signal isn't being emitted
+        ///
+        /// @return True when the list was released
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool releaseEmptyHandlerList();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Extracts the widget stored in the first parameter
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,9 +288,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct HandlerList;
+
         bool m_enabled = true;
-        String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+        const char* m_name; // Points to a string literal or an interned name, so that signals without handlers don't allocate any memory
+        std::shared_ptr<HandlerList> m_handlers; // Only allocated while handlers are connected
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
@@ -271,6 +309,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalTyped(const char (&name)[N]) :
+            Signal{name, 1}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,7 +378,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param);
@@ -350,6 +397,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalTyped2(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,7 +467,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param1);
@@ -440,6 +496,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalChildWindow(const char (&name)[N]) :
+            Signal{name, 1}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,6 +587,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalItem(const char (&name)[N]) :
+            Signal{name, 3}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -629,6 +703,14 @@ TGUI_MODULE_EXPORT namespace tgui
     class TGUI_API SignalPanelListBoxItem : public Signal
     {
     public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalPanelListBoxItem(const char (&name)[N]) :
+            Signal{name, 3}
+        { }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -783,6 +865,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalFileDialogPaths(const char (&name)[N]) :
+            Signal{name, 3}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -884,6 +975,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalShowEffect(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -986,6 +1086,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalAnimationType(const char (&name)[N]) :
+            Signal{name, 1}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1060,6 +1169,15 @@ TGUI_MODULE_EXPORT namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        SignalItemHierarchy(const char (&name)[N]) :
+            Signal{name, 2}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
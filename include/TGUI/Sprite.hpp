@@ -244,12 +244,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVertices();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Starts using the SVG texture that was being rasterized in the background, if it is ready.
+        /// Returns true if the texture of the sprite was changed.
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updatePendingSvgTexture();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         Vector2f    m_size;
         Texture     m_texture;
         std::shared_ptr<BackendTexture> m_svgTexture;
+        std::shared_ptr<BackendTexture> m_pendingSvgTexture; // Texture that replaces m_svgTexture once it has been rasterized
         std::vector<Vertex> m_vertices;
         std::vector<unsigned int> m_indices;
 
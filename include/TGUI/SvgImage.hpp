@@ -92,6 +92,115 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rasterize(BackendTexture& texture, Vector2u size);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image drawn at the given size
+        ///
+        /// @param size  Size that the texture should have, before it is multiplied with the font scale of the backend
+        ///
+        /// Textures are shared between all callers that request the same size of the same image, so the returned texture must
+        /// not be changed. The image is only rasterized again when no texture with the requested size exists yet.
+        ///
+        /// @return Texture with the rasterized image
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexture(Vector2u size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether a texture returned by getTexture already contains the rasterized image
+        ///
+        /// @param texture  Texture that was returned by getTexture
+        ///
+        /// @return False if the image is still being rasterized in the background, true otherwise
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTextureReady(const std::shared_ptr<BackendTexture>& texture) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether svg images are rasterized on background threads
+        ///
+        /// @param enabled  Should getTexture return immediately and rasterize the image on a different thread?
+        ///
+        /// When enabled, new textures are rasterized into a pixel buffer on a worker thread. The buffer is only copied into the
+        /// texture on the gui thread, when Backend::updateSvgTextures is called (which happens automatically before drawing).
+        /// Sprites keep drawing their previous texture (scaled to the new size) until the new one is ready.
+        /// Use Backend::waitForSvgRasterizations to block until all pending rasterizations are finished.
+        ///
+        /// Asynchronous rasterization is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncRasterizationEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether svg images are rasterized on background threads
+        ///
+        /// @return Does getTexture return immediately and rasterize the image on a different thread?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isAsyncRasterizationEnabled();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are still being rasterized in the background or that still need uploading
+        ///
+        /// @return Amount of textures that don't contain their image yet
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getPendingRasterizationCount();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Copies the pixels that were rasterized in the background into their textures
+        ///
+        /// @param waitForPending  Should the function block until all pending rasterizations are finished?
+        ///
+        /// @return True if at least one texture was updated
+        ///
+        /// This function must be called from the thread that uses the backend. Use Backend::updateSvgTextures instead, which
+        /// also lets sprites switch to their new texture.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool uploadFinishedRasterizations(bool waitForPending);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much memory the rasterized textures of all svg images may use before unused ones are removed
+        ///
+        /// @param bytes  Maximum size of all rasterized textures that are kept, in bytes
+        ///
+        /// Textures that are no longer used by any sprite are kept in case the same size is requested again. When the total
+        /// memory of the rasterized textures exceeds the budget, the unused textures that were least recently requested are
+        /// removed. Textures that are still in use are never removed, so the budget may be exceeded when many are used.
+        ///
+        /// The default budget is 32 MB.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setTextureCacheBudget(std::size_t bytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory the rasterized textures of all svg images may use before unused ones are removed
+        ///
+        /// @return Maximum size of all rasterized textures that are kept, in bytes
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getTextureCacheBudget();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory is used by the rasterized textures of all svg images, whether they are used or not
+        ///
+        /// @return Size of the pixels of all rasterized textures that are stored, in bytes
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getTextureCacheMemoryUsage();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -50,6 +50,10 @@ TGUI_MODULE_EXPORT namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // Location of the image inside backendTexture when the texture is an atlas page shared with other images.
+        // This rect is empty when the image has a texture of its own.
+        UIntRect atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +85,74 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::size_t getCachedImagesCount();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together into shared atlas textures
+        ///
+        /// @param enabled  Should images that are loaded from now on be packed into atlas pages?
+        ///
+        /// When enabled, images loaded from a file (e.g. all images of a theme) that are not larger than the maximum image size
+        /// are copied into a larger texture that is shared with other images. Widgets using images on the same atlas page can
+        /// then be drawn without switching textures. The part rect and middle rect of the Texture remain relative to the image.
+        ///
+        /// Images that are already loaded are not affected by this setting. The atlas is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together into shared atlas textures
+        ///
+        /// @return Are images that are loaded from now on packed into atlas pages?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isAtlasEnabled();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum width and height of images that are packed into the atlas
+        ///
+        /// @param size  Images with a width or height above this value get a texture of their own (default is 256)
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasMaxImageSize(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum width and height of images that are packed into the atlas
+        ///
+        /// @return Largest width or height of an image that can be placed on an atlas page
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasMaxImageSize();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of atlas pages that are created from now on
+        ///
+        /// @param size  Size of the square atlas textures (default is 1024)
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPageSize(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of atlas pages that are created from now on
+        ///
+        /// @return Size of the square atlas textures
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasPageSize();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many atlas pages currently exist
+        ///
+        /// @return Number of atlas textures containing at least one image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAtlasPageCount();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -31,6 +31,8 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <functional>
+    #include <cstdint>
+    #include <limits>
     #include <memory>
     #include <vector>
 #endif
@@ -47,6 +49,9 @@ TGUI_MODULE_EXPORT namespace tgui
     ///
     /// This timer is not intended to be used when high accuracy is required.
     /// If the callback is e.g. a millisecond too late then this extra time is NOT subtracted from the next scheduled time.
+    ///
+    /// Active timers are kept in a queue that is sorted on the time at which they expire, so updating the timers only costs
+    /// time for the timers that actually trigger.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Timer : public std::enable_shared_from_this<Timer>
     {
@@ -135,6 +140,32 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void restart();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether timers with similar intervals should be triggered at the same time
+        ///
+        /// @param coalesce  Should the moments at which timers expire be aligned?
+        ///
+        /// When enabled, timers may trigger slightly later than their interval (at most 1/16th of the interval), so that timers
+        /// with similar intervals (e.g. the blinking carets and polling widgets) expire during the same update. This reduces the
+        /// amount of times the gui has to wake up when many timers are running.
+        ///
+        /// Only affects timers that are started or restarted after calling this function. Coalescing is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setCoalescingEnabled(bool coalesce);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether timers with similar intervals are triggered at the same time
+        ///
+        /// @return Are the moments at which timers expire aligned?
+        ///
+        /// @see setCoalescingEnabled
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isCoalescingEnabled();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Updates the timers and calls their callback functions
@@ -167,14 +198,44 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::shared_ptr<Timer>> m_activeTimers;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates when the timer expires and puts it in the queue of active timers, or moves it if it was already queued
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void schedule();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer from the queue of active timers, if it was queued
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unschedule();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Restores the order of the queue after the timer at the given index was inserted or its deadline was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateQueuePosition(std::size_t index);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the first timer expires before the second one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool expiresBefore(const Timer& left, const Timer& right);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::size_t notQueued = std::numeric_limits<std::size_t>::max();
+
+        static std::vector<std::shared_ptr<Timer>> m_activeTimers; // Binary min-heap, ordered on the deadline of the timers
+        static Duration m_currentTime; // Total time passed to updateTime, the deadlines are relative to this clock
+        static std::uint64_t m_lastScheduleSequence;
+        static bool m_coalescingEnabled;
 
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        Duration m_deadline; // Value of m_currentTime at which the timer expires
+        std::uint64_t m_scheduleSequence = 0; // Keeps timers with the same deadline in the order in which they were started
+        std::size_t m_queueIndex = notQueued; // Position in m_activeTimers
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -1134,9 +1134,41 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateTextSize();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the layouts that depend on the position or size changes that were delayed by the gui
+        ///
+        /// This function is called by BackendGui::updateLayouts when deferred layout updates are enabled.
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateDeferredLayout();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Triggers onPositionChange and onSizeChange if the position or size differs from before the deferred updates
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void emitDeferredLayoutSignals();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Drops the deferred layout changes of this widget without processing them
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelDeferredLayout();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Flags that are stored in m_deferredLayoutChanges
+        enum DeferredLayoutChange : unsigned int
+        {
+            DeferredPositionChange = 1 << 0,
+            DeferredSizeChange = 1 << 1,
+            DeferredChildrenAutoLayout = 1 << 2,
+            DeferredParentAutoLayout = 1 << 3
+        };
+
         using SavingRenderersMap = std::map<const Widget*, std::pair<std::unique_ptr<DataIO::Node>, String>>;
         using LoadingRenderersMap = std::map<String, std::shared_ptr<RendererData>>;
 
@@ -1177,6 +1209,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateBoundSizeLayouts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the parent gui wants position and size changes to be processed later
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isLayoutDeferred() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds changes (DeferredLayoutChange flags) that have to be processed by the next BackendGui::updateLayouts call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueDeferredLayoutChanges(unsigned int changes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Postpones the processing of a position or size change (DeferredPositionChange or DeferredSizeChange) until the gui
+        // updates its layouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deferLayoutChange(DeferredLayoutChange change);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget from the deferred layout queues of the gui and drops the changes that weren't processed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void forgetDeferredLayout();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1228,6 +1284,14 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
 
+        // Position and size changes that are waiting for BackendGui::updateLayouts when deferred layout updates are enabled
+        unsigned int m_deferredLayoutChanges = 0;
+        bool m_deferredLayoutSignalsPending = false;
+        std::size_t m_deferredLayoutUpdateIndex = 0; // Index in the queue of the gui, only valid while m_deferredLayoutChanges != 0
+        std::size_t m_deferredLayoutSignalsIndex = 0; // Index in the signal list of the gui, only valid while signals are pending
+        Vector2f m_positionBeforeDeferral;
+        Vector2f m_sizeBeforeDeferral;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores the flag indicating whether this widget is enabled
         ///
@@ -53,6 +53,7 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             Text text;
             String string;
+            double top = 0; //!< Sum of the heights of the lines above it, offset by the same value for all lines
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,7 +347,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void recalculateAllLines();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Recalculates the top positions of all lines based on the height of each line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLineTops();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the space used by all the lines, based on the top positions of the first line and m_linesBottom
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
@@ -420,6 +426,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::deque<Line> m_lines;
 
+        // Position below the last line, in the same coordinates as the top of each line
+        double m_linesBottom = 0;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
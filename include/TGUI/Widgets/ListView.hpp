@@ -395,9 +395,72 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes all items from the list
+        ///
+        /// If the list view had virtual items then it will no longer be virtual after calling this function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the items by virtual items of which the texts are provided by a callback function
+        ///
+        /// @param itemCount     Amount of items in the list view
+        /// @param cellProvider  Function that returns the text of an item (first parameter) in a column (second parameter)
+        ///
+        /// The list view doesn't store the texts of virtual items, it only calls the cell provider for the items that are
+        /// visible and recycles the texts of items that get scrolled out of view. This allows displaying millions of items.
+        /// Selecting, hovering and sorting items works with indices, just like with normal items. After sorting, the index that
+        /// is passed to the cell provider differs from the index of the displayed item, see getVirtualItemIndex.
+        ///
+        /// Functions that add items can't be used while the list view contains virtual items. Items can't have icons or data
+        /// and auto-resizing columns only take the header text into account. Virtual items are not saved to a file.
+        /// Calling removeAllItems or passing a nullptr cell provider turns the list view back into a normal list view.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, std::function<String(std::size_t itemIndex, std::size_t columnIndex)> cellProvider);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of virtual items, without changing the cell provider
+        ///
+        /// @param itemCount  Amount of items in the list view
+        ///
+        /// The texts of the visible items are requested again from the cell provider.
+        /// If the items were sorted then the new items are placed at the bottom and the order of the other items remains the same.
+        /// This function does nothing if the list view doesn't contain virtual items.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the texts of the visible virtual items again from the cell provider
+        ///
+        /// Call this function when the data that is returned by the cell provider has changed.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshVirtualItems();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list view contains virtual items
+        ///
+        /// @return Was setVirtualItems called with a cell provider?
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isVirtual() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index that is passed to the cell provider for the virtual item that is displayed at a given index
+        ///
+        /// @param index  Index of the displayed item
+        ///
+        /// @return Index of the item in the data of the cell provider. This is the same as the index unless the items were sorted.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getVirtualItemIndex(std::size_t index) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -555,6 +618,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sort items on the values in a column, without having to provide a comparator
+        ///
+        /// @param index      The index of the column for sorting
+        /// @param ascending  Should the item with the lowest value be placed at the top?
+        ///
+        /// When all non-empty values in the column are numbers, the items are sorted on their numeric value.
+        /// Otherwise the texts are compared. Items with equal values keep their relative order.
+        ///
+        /// This function is faster than the sort function that takes a comparator, as the values are only converted once and
+        /// sorting a large list is spread over multiple threads. It can e.g. be called from the onHeaderClick callback.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByColumn(std::size_t index, bool ascending = true);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -1051,6 +1130,26 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVerticalScrollbarMaximum();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the range of items that are visible with the current scrollbar value (lastItem is not visible)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void findVisibleItems(std::size_t& firstItem, std::size_t& lastItem) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes certain that the visible virtual items are in m_virtualItemPool, reusing the items that were already there
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItemPool();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the texts in a column for all items. Texts of virtual items are stored in the storage parameter.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<const String*> getColumnTexts(std::size_t column, std::vector<String>& storage) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reorders the items, order[i] contains the index of the item that has to be moved to index i
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyItemOrder(std::vector<std::size_t>& order);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the header text for a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1092,6 +1191,13 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<Item>   m_items;
         std::set<std::size_t> m_selectedItems;
 
+        // When there are virtual items, m_items is empty and only the visible items are stored in m_virtualItemPool
+        std::function<String(std::size_t, std::size_t)> m_virtualCellProvider;
+        std::size_t m_virtualItemCount = 0;
+        std::vector<std::size_t> m_virtualItemOrder; // Index passed to the cell provider for each displayed item, empty when not sorted
+        std::vector<Item> m_virtualItemPool;
+        std::size_t m_virtualItemPoolStart = 0; // Index of the displayed item that is stored in the front of m_virtualItemPool
+
         int m_hoveredItem = -1;
         int m_firstSelectedItemIndex = -1;
         int m_focusedItemIndex = -1;
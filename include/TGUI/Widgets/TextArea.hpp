@@ -109,6 +109,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Appends some text to the text that was already in the text area
         ///
         /// @param text  Text that will be added to the text that is already in the text area
+        ///
+        /// Only the last paragraph and the added text are word-wrapped again, so this function is suited for continuously
+        /// adding lines to a log. The caret is moved to the end of the text. Both onTextAppend and onTextChange are emitted,
+        /// the entire text is only copied to pass it to onTextChange when a handler is connected to that signal.
+        ///
+        /// @see setMaximumLines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(String text);
 
@@ -192,6 +198,32 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::size_t getMaximumCharacters() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of lines that the text area can contain
+        ///
+        /// @param maxLines  The new line limit.
+        ///                  Set it to 0 to disable the limit
+        ///
+        /// When changing the text causes it to exceed the line limit, the oldest lines are removed until the text contains
+        /// exactly the maximum amount of lines. This happens when calling setText or addText, but also while typing.
+        /// The limit is on the lines after word-wrap is applied, like the value returned by getLinesCount.
+        ///
+        /// This line limit is disabled by default.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumLines(std::size_t maxLines = 0);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of lines that the text area can contain
+        ///
+        /// @return The line limit
+        ///         The function will return 0 when there is no limit.
+        ///
+        /// @since TGUI 1.4
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getMaximumLines() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the string that is inserted when the Tab key is pressed
         ///
@@ -455,10 +487,15 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2<std::size_t> findCaretPosition(Vector2f position) const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Gets the index of either m_selStart or m_selEnd
+        // Gets the index in m_text of either m_selStart or m_selEnd
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::size_t getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gets the line and column of a character index, this is the reverse of getIndexOfSelectionPos
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2<std::size_t> getSelectionPosOfIndex(std::size_t index) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -477,6 +514,62 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection, const bool emitCaretChangedPosition = true);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearrange only the paragraphs that were changed, after characters were removed and/or inserted at the given index.
+        // The selection is kept, it has to be located before the change or already point to its new position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeChangedText(std::size_t changeIndex, std::size_t removedCount, std::size_t insertedCount, bool emitCaretChangedPosition = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text between the two indices into lines (by using word wrap) and appends them to the given vectors.
+        // The indices have to be located at the start and end of a paragraph. Returns false if there is no room for the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool splitTextIntoLines(std::size_t startIndex, std::size_t endIndex, std::vector<String>& lines,
+                                std::vector<std::size_t>& lineStarts, std::vector<float>& lineWidths) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the oldest lines when there are more lines than allowed by m_maxLines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeExcessLines();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Emits onTextChange, the text is only copied when a handler is connected and removed lines are still stored in front of it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void emitTextChange();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the selection at the given indices and updates everything that depends on the lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishRearrangingText(std::size_t selStart, std::size_t selEnd, bool emitCaretChangedPosition);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index in m_text of the first character of a line, taking the postponed shift into account.
+        // The index includes the characters that were removed by the line limit, the visible text starts at m_textStart.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineStart(std::size_t lineIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the first line to which the postponed shift of m_lineStarts applies. Only the lines between the old and new
+        // boundary are updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveLineStartsShiftBegin(std::size_t lineIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the widest line in all lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateMaxLineWidth();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the maximum line width with the lines in the range [firstLine, lastLine). Returns true when one of these lines
+        // is the widest line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateMaxLineWidth(std::size_t firstLine, std::size_t lastLine);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether one of the lines in the range [firstLine, lastLine) is as wide as the widest line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool containsWidestLine(std::size_t firstLine, std::size_t lastLine) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,6 +580,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the five text pieces with the lines near the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDisplayedTexts();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Handles "Backspace" key press
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -634,6 +732,7 @@ TGUI_MODULE_EXPORT namespace tgui
     public:
 
         SignalString onTextChange = {"TextChanged"};             //!< The text was changed. Optional parameter: new text
+        SignalString onTextAppend = {"TextAppended"};            //!< Text was added with addText. Optional parameter: added text
         Signal onSelectionChange = {"SelectionChanged"};         //!< Selected text changed
         Signal onCaretPositionChange = {"CaretPositionChanged"}; //!< Caret position changed
 
@@ -646,15 +745,42 @@ TGUI_MODULE_EXPORT namespace tgui
         // The width of the largest line
         float m_maxLineWidth = 0;
 
-        std::vector<String> m_lines;
+        // Deques are used so that the line limit can remove the oldest lines without moving all other lines
+        std::deque<String> m_lines;
+        std::deque<std::size_t> m_lineStarts; // Index in m_text of the first character of each line in m_lines
+        std::deque<float> m_lineWidths; // Width of each line in m_lines, only calculated when there is no word wrap and no monospace optimization
+
+        // Characters at the front of m_text that were removed by the line limit. They are only erased from m_text once they
+        // take up more than half of it, so that the remaining text doesn't have to be moved each time a line is removed.
+        std::size_t m_textStart = 0;
+
+        // Typing would require updating the start of every line below the caret. Instead, the lines starting from
+        // m_lineStartsShiftBegin still have to be moved by m_lineStartsShift characters (which may wrap around to subtract).
+        std::size_t m_lineStartsShift = 0;
+        std::size_t m_lineStartsShiftBegin = 0;
+
+        // Character count of the longest line, only used when the monospaced font optimization is enabled
+        std::size_t m_maxLineLength = 0;
+
+        // When the line limit removes the widest line, searching the new widest line is postponed until enough lines were removed
+        // to make up for going over all lines. Until then the maximum line width can be larger than the width of the widest line.
+        bool m_maxLineWidthOutdated = false;
+        std::size_t m_linesRemovedSinceMaxLineWidth = 0;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
+        // The maximum lines (0 by default, which means no limit)
+        std::size_t m_maxLines = 0;
+
         // What is known about the visible lines?
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // Range of lines that are stored in the text pieces, only lines near the visible area are given to the texts
+        std::size_t m_displayedLinesStart = 0;
+        std::size_t m_displayedLinesEnd = 0;
+
         // Information about the selection
         Vector2<std::size_t> m_selStart;
         Vector2<std::size_t> m_selEnd;
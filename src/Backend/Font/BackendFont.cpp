@@ -26,7 +26,9 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,6 +120,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int BackendFont::getTexturePageCount(unsigned int)
+    {
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFont::getTexturePage(unsigned int page, unsigned int characterSize, unsigned int& textureVersion)
+    {
+        TGUI_ASSERT(page == 0, "BackendFont::getTexturePage can only be called with page 0 when the font has a single texture");
+        (void)page;
+        return getTexture(characterSize, textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFont::getTexturePageSize(unsigned int page, unsigned int characterSize)
+    {
+        TGUI_ASSERT(page == 0, "BackendFont::getTexturePageSize can only be called with page 0 when the font has a single texture");
+        (void)page;
+        return getTextureSize(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::uint64_t BackendFont::constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
     {
         // Create a unique key for every character.
@@ -163,6 +190,48 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::addDirtyRect(const std::shared_ptr<BackendTexture>& texture, UIntRect& dirtyRect, UIntRect rect)
+    {
+        // When there is no texture yet, the entire image will be uploaded when the texture is created
+        if (!texture)
+            return;
+
+        if ((dirtyRect.width == 0) || (dirtyRect.height == 0))
+        {
+            dirtyRect = rect;
+            return;
+        }
+
+        const unsigned int left = std::min(dirtyRect.left, rect.left);
+        const unsigned int top = std::min(dirtyRect.top, rect.top);
+        const unsigned int right = std::max(dirtyRect.left + dirtyRect.width, rect.left + rect.width);
+        const unsigned int bottom = std::max(dirtyRect.top + dirtyRect.height, rect.top + rect.height);
+        dirtyRect = {left, top, right - left, bottom - top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::uploadDirtyRect(const std::shared_ptr<BackendTexture>& texture, UIntRect& dirtyRect,
+                                      const std::uint8_t* pixels, unsigned int textureWidth, unsigned int bytesPerPixel)
+    {
+        if (!texture || (dirtyRect.width == 0) || (dirtyRect.height == 0))
+            return true;
+
+        auto dirtyPixels = MakeUniqueForOverwrite<std::uint8_t[]>(dirtyRect.width * dirtyRect.height * bytesPerPixel);
+        for (unsigned int y = 0; y < dirtyRect.height; ++y)
+        {
+            std::memcpy(&dirtyPixels[y * dirtyRect.width * bytesPerPixel],
+                        &pixels[(((dirtyRect.top + y) * textureWidth) + dirtyRect.left) * bytesPerPixel],
+                        dirtyRect.width * bytesPerPixel);
+        }
+
+        const bool updated = texture->updatePixels(dirtyRect, dirtyPixels.get());
+        dirtyRect = {};
+        return updated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,7 +45,9 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +58,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Fills part of the glyph atlas with transparent pixels
+    static void clearAtlasPixels(std::uint8_t* pixels, std::size_t pixelCount, unsigned int bytesPerPixel)
+    {
+        if (bytesPerPixel == 1)
+        {
+            std::memset(pixels, 0, pixelCount);
+            return;
+        }
+
+        // Color is always white, alpha channel contains whether the pixel is empty of not
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            *pixels++ = 255;
+            *pixels++ = 255;
+            *pixels++ = 255;
+            *pixels++ = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::~BackendFontFreetype()
     {
         cleanup();
@@ -71,37 +94,19 @@ namespace tgui
         m_cachedAscents.clear();
         m_cachedDescents.clear();
         m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
+        m_characterSizeLastUsed.clear();
+        m_useCounter = 0;
+        m_frameStartUseCounter = 0;
+        m_sizeCaches.clear();
+        m_lastSizeCache = nullptr;
+        m_texturePages.clear();
         m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
 
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
+        // Only store the alpha channel in the atlas if the renderer supports it, as the RGB channels would always be white
+        const bool alphaTexturesSupported = isBackendSet() && getBackend()->hasRenderer() && getBackend()->getRenderer()->supportsAlphaTextures();
+        m_bytesPerPixel = alphaTexturesSupported ? 1 : 4;
 
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
-
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
-        {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
-        }
-
-        m_textureSize = initialTextureSize;
+        addTexturePage();
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
@@ -127,6 +132,11 @@ namespace tgui
         m_fileContents = std::move(data);
         m_library = library;
         m_face = face;
+
+        // Looking up the glyph index is needed for kerning, so do it once for the most common characters
+        for (unsigned int i = 0; i < m_latin1GlyphIndices.size(); ++i)
+            m_latin1GlyphIndices[i] = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(i));
+
         return true;
     }
 
@@ -150,6 +160,7 @@ namespace tgui
         glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
         glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
         glyph.textureRect = internalGlyph.textureRect;
+        glyph.texturePage = internalGlyph.texturePage;
         return glyph;
     }
 
@@ -161,7 +172,29 @@ namespace tgui
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_face)
+            return 0;
+
+        // Pairs of ASCII characters are stored in a table, which avoids hashing when measuring or drawing most text.
+        // The result of other pairs only depends on the glyphs, so characters that map to the same glyph share the cached value.
+        SizeCache& sizeCache = getSizeCache(static_cast<unsigned int>(characterSize * m_fontScale), bold);
+        const bool asciiPair = (first < 128) && (second < 128);
+        const std::size_t asciiPairIndex = asciiPair ? ((static_cast<std::size_t>(first) << 7) | second) : 0;
+        std::uint64_t pairKey = 0;
+        if (asciiPair)
+        {
+            if (sizeCache.asciiKerningLoaded[asciiPairIndex])
+                return sizeCache.asciiKerning[asciiPairIndex] / m_fontScale;
+        }
+        else
+        {
+            pairKey = (static_cast<std::uint64_t>(getGlyphIndex(first)) << 32) | getGlyphIndex(second);
+            const auto it = sizeCache.kerning.find(pairKey);
+            if (it != sizeCache.kerning.end())
+                return it->second / m_fontScale;
+        }
+
+        if (!setCurrentSize(characterSize))
             return 0;
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
@@ -172,19 +205,34 @@ namespace tgui
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
         if (FT_HAS_KERNING(m_face))
+            FT_Get_Kerning(m_face, getGlyphIndex(first), getGlyphIndex(second), FT_KERNING_UNFITTED, &kerning);
+
+        float scaledKerning;
+        if (!FT_IS_SCALABLE(m_face))
+        {
+            // X advance is already in pixels for bitmap fonts
+            scaledKerning = static_cast<float>(kerning.x);
+        }
+        else
         {
-            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
-            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
-            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+            // Combine kerning with compensation deltas and return the X advance
+            // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+            scaledKerning = std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / unitsPerPixel);
         }
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(m_face))
-            return static_cast<float>(kerning.x) / m_fontScale;
+        // Loading the glyphs could have evicted other sizes, but the size cache that we are using is never removed here
+        if (asciiPair)
+        {
+            if (sizeCache.asciiKerning.empty())
+                sizeCache.asciiKerning.resize(sizeCache.asciiKerningLoaded.size());
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / unitsPerPixel) / m_fontScale;
+            sizeCache.asciiKerning[asciiPairIndex] = scaledKerning;
+            sizeCache.asciiKerningLoaded[asciiPairIndex] = true;
+        }
+        else
+            sizeCache.kerning[pairKey] = scaledKerning;
+
+        return scaledKerning / m_fontScale;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,26 +352,89 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize, unsigned int& textureVersion)
     {
-        if (m_texture)
-        {
-            textureVersion = m_textureVersion;
-            return m_texture;
-        }
+        return getTexturePage(0, characterSize, textureVersion);
+    }
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontFreetype::getTextureSize(unsigned int characterSize)
+    {
+        return getTexturePageSize(0, characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getTexturePageCount(unsigned int)
+    {
+        return static_cast<unsigned int>(m_texturePages.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexturePage(unsigned int page, unsigned int characterSize, unsigned int& textureVersion)
+    {
+        textureVersion = m_textureVersion;
+        if (page >= m_texturePages.size())
+            return nullptr;
+
+        // Texts request their textures each time they are drawn, so this is where we keep track of which sizes are still used
+        markCharacterSizeUsed(static_cast<unsigned int>(characterSize * m_fontScale));
+
+        // If glyphs were added since the texture was last uploaded then only upload the part of the texture that changed.
+        // If the backend doesn't support partial updates then upload the entire image again. The size of the texture
+        // remains the same, so the texture can still be reused and the texture coordinates of texts remain valid.
+        TexturePage& texturePage = m_texturePages[page];
+        if (!uploadDirtyRect(texturePage.texture, texturePage.dirtyRect, texturePage.pixels.get(), texturePage.size, m_bytesPerPixel))
+            loadAtlasTexture(page);
+
+        if (texturePage.texture)
+            return texturePage.texture;
+
+        texturePage.texture = getBackend()->getRenderer()->createTexture();
+        loadAtlasTexture(page);
 
         textureVersion = ++m_textureVersion;
-        return m_texture;
+        return texturePage.texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontFreetype::getTexturePageSize(unsigned int page, unsigned int)
+    {
+        if (page >= m_texturePages.size())
+            return {0, 0};
+
+        return {m_texturePages[page].size, m_texturePages[page].size};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setMaximumTexturePageSize(unsigned int size)
+    {
+        m_maxTexturePageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getMaximumTexturePageSize() const
+    {
+        return m_maxTexturePageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setMaximumTexturePageCount(unsigned int count)
+    {
+        m_maxTexturePageCount = count;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Vector2u BackendFontFreetype::getTextureSize(unsigned int)
+    unsigned int BackendFontFreetype::getMaximumTexturePageCount() const
     {
-        return {m_textureSize, m_textureSize};
+        return m_maxTexturePageCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,8 +442,11 @@ namespace tgui
     void BackendFontFreetype::setSmooth(bool smooth)
     {
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+        for (auto& texturePage : m_texturePages)
+        {
+            if (texturePage.texture)
+                texturePage.texture->setSmooth(m_isSmooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -344,8 +458,8 @@ namespace tgui
 
         BackendFont::setFontScale(scale);
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // Force texts to update their glyphs. The texture itself doesn't change, so it doesn't have to be recreated.
+        ++m_textureVersion;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,6 +470,7 @@ namespace tgui
         if (!m_face)
             return glyph;
 
+        glyph.characterSize = static_cast<unsigned int>(characterSize * m_fontScale);
         if (!setCurrentSize(characterSize))
             return glyph;
 #if defined(__GNUC__)
@@ -439,13 +554,14 @@ namespace tgui
         // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
         const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
+        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding), glyph.characterSize, glyph.texturePage);
         glyph.textureRect.left += padding;
         glyph.textureRect.top += padding;
         glyph.textureRect.width -= 2 * padding;
         glyph.textureRect.height -= 2 * padding;
 
         // Extract the glyph's pixels from the bitmap
+        TexturePage& texturePage = m_texturePages[glyph.texturePage];
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
@@ -455,8 +571,8 @@ namespace tgui
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
                     // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * texturePage.size;
+                    texturePage.pixels[index * m_bytesPerPixel + (m_bytesPerPixel - 1)] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
                 }
             }
         }
@@ -468,14 +584,15 @@ namespace tgui
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
                     // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * texturePage.size;
+                    texturePage.pixels[index * m_bytesPerPixel + (m_bytesPerPixel - 1)] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
                 }
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
+        // Only the part of the texture that contains the new glyph will have to be uploaded again
+        addDirtyRect(texturePage.texture, texturePage.dirtyRect, {glyph.textureRect.left - padding, glyph.textureRect.top - padding,
+                                                                  glyph.textureRect.width + (2 * padding), glyph.textureRect.height + (2 * padding)});
 
         FT_Done_Glyph(glyphDesc);
         return glyph;
@@ -485,8 +602,22 @@ namespace tgui
 
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
-                                                         bold, outlineThickness * m_fontScale);
+        const unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+
+        // Glyphs of the Latin-1 range are stored in an array to avoid hashing when measuring or drawing most text
+        if ((codePoint < 256) && (outlineThickness == 0))
+        {
+            SizeCache& sizeCache = getSizeCache(scaledCharacterSize, bold);
+            if (!sizeCache.latin1GlyphsLoaded[codePoint])
+            {
+                sizeCache.latin1Glyphs[codePoint] = loadGlyph(codePoint, characterSize, bold, outlineThickness);
+                sizeCache.latin1GlyphsLoaded[codePoint] = true;
+            }
+
+            return sizeCache.latin1Glyphs[codePoint];
+        }
+
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, scaledCharacterSize, bold, outlineThickness * m_fontScale);
 
         const auto it = m_glyphs.find(glyphKey);
         if (it != m_glyphs.end())
@@ -498,85 +629,295 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    BackendFontFreetype::SizeCache& BackendFontFreetype::getSizeCache(unsigned int scaledCharacterSize, bool bold)
+    {
+        const unsigned int key = (scaledCharacterSize << 1) | (bold ? 1u : 0u);
+        if (m_lastSizeCache && (m_lastSizeCacheKey == key))
+            return *m_lastSizeCache;
+
+        // Pointers to elements of an unordered_map remain valid when other elements are inserted
+        m_lastSizeCache = &m_sizeCaches[key];
+        m_lastSizeCacheKey = key;
+        return *m_lastSizeCache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getGlyphIndex(char32_t codePoint) const
     {
-        // Find the line that where the glyph fits well.
-        // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
-        Row* bestRow = nullptr;
-        float bestRatio = 0;
-        for (auto& row : m_rows)
+        if (codePoint < m_latin1GlyphIndices.size())
+            return m_latin1GlyphIndices[codePoint];
+        else
+            return FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height, unsigned int characterSize, unsigned int& page)
+    {
+        // Glyphs that are being loaded will likely be drawn soon, so don't evict them before they are drawn
+        markCharacterSizeUsed(characterSize);
+
+        while (true)
         {
-            float ratio = static_cast<float>(height) / row.height;
+            // Find the line that where the glyph fits well. Rows only contain glyphs of a single character size, so that
+            // they can be reused when the glyphs of that size are evicted.
+            // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
+            Row* bestRow = nullptr;
+            float bestRatio = 0;
+            for (unsigned int pageIndex = 0; pageIndex < m_texturePages.size(); ++pageIndex)
+            {
+                TexturePage& texturePage = m_texturePages[pageIndex];
+                for (auto& row : texturePage.rows)
+                {
+                    if ((row.characterSize != characterSize) && (row.characterSize != 0))
+                        continue;
 
-            // Ignore rows that are either too small or too high
-            if ((ratio < 0.7f) || (ratio > 1.f))
-                continue;
+                    float ratio = static_cast<float>(height) / row.height;
 
-            // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
-                continue;
+                    // Ignore rows that are either too small or too high. Unused rows accept any glyph that isn't too high.
+                    if ((ratio > 1.f) || ((ratio < 0.7f) && (row.characterSize != 0)))
+                        continue;
 
-            // Make sure that this new row is the best found so far
-            if (ratio < bestRatio)
-                continue;
+                    // Check if there's enough horizontal space left in the row
+                    if (width > texturePage.size - row.width)
+                        continue;
+
+                    // Make sure that this new row is the best found so far
+                    if (ratio < bestRatio)
+                        continue;
+
+                    // The current row passed all the tests: we can select it
+                    bestRow = &row;
+                    bestRatio = ratio;
+                    page = pageIndex;
+                }
+            }
+
+            // If we didn't find a matching row, create a new one (10% taller than the glyph)
+            const unsigned int rowHeight = height + (height / 10);
+            if (!bestRow)
+            {
+                // Check if the glyph can fit in one of the pages. Pages never grow, as that would require uploading all glyphs again.
+                for (unsigned int pageIndex = 0; pageIndex < m_texturePages.size(); ++pageIndex)
+                {
+                    TexturePage& texturePage = m_texturePages[pageIndex];
+                    if ((texturePage.nextRow + rowHeight >= texturePage.size) || (width >= texturePage.size))
+                        continue;
+
+                    // We can now create the new row
+                    texturePage.rows.emplace_back(texturePage.nextRow, rowHeight, characterSize);
+                    texturePage.nextRow += rowHeight;
+                    bestRow = &texturePage.rows.back();
+                    page = pageIndex;
+                    break;
+                }
+            }
+
+            if (bestRow)
+            {
+                bestRow->characterSize = characterSize;
 
-            // The current row passed all the tests: we can select it
-            bestRow = &row;
-            bestRatio = ratio;
+                // Find the glyph's rectangle on the selected row
+                UIntRect rect{bestRow->width, bestRow->top, width, height};
+
+                // Update the row informations
+                bestRow->width += width;
+                return rect;
+            }
+
+            // All pages are full. If we already have too many pages then try to remove glyphs that haven't been drawn recently.
+            // The loop is executed again after evicting glyphs, as it may have freed a row where the glyph fits.
+            // Only pages that reached the size limit are counted, the smaller pages that were created before them hold few glyphs.
+            const unsigned int sizeLimit = getTexturePageSizeLimit();
+            const auto fullSizePageCount = static_cast<std::size_t>(std::count_if(m_texturePages.begin(), m_texturePages.end(),
+                [sizeLimit](const TexturePage& texturePage){ return texturePage.size >= sizeLimit; }));
+            const bool evictGlyphs = (m_maxTexturePageCount > 0) && (fullSizePageCount >= m_maxTexturePageCount);
+            if (!evictGlyphs || !evictLeastRecentlyUsedCharacterSize(characterSize))
+                addTexturePage(std::max(width, 3 + rowHeight) + 1); // The first 3 rows of a page are reserved
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addTexturePage(unsigned int minimumSize)
+    {
+        constexpr unsigned int initialTextureSize = 128;
+
+        // Each page is twice as large as the previous one until the size limit is reached, so that fonts that only need a few
+        // glyphs don't use much memory. A glyph that doesn't fit in a page of the maximum size gets a larger page.
+        unsigned int pageSize = initialTextureSize;
+        if (!m_texturePages.empty())
+            pageSize = std::max(initialTextureSize, std::min(m_texturePages.back().size * 2, getTexturePageSizeLimit()));
+        while (pageSize < minimumSize)
+            pageSize *= 2;
+
+        TexturePage texturePage;
+        texturePage.size = pageSize;
+        texturePage.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(pageSize) * pageSize * m_bytesPerPixel);
+        clearAtlasPixels(texturePage.pixels.get(), static_cast<std::size_t>(pageSize) * pageSize, m_bytesPerPixel);
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                texturePage.pixels[((pageSize * y) + x) * m_bytesPerPixel + (m_bytesPerPixel - 1)] = 255;
         }
 
-        // If we didn't find a matching row, create a new one (10% taller than the glyph)
-        if (!bestRow)
+        m_texturePages.push_back(std::move(texturePage));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::evictLeastRecentlyUsedCharacterSize(unsigned int characterSizeInUse)
+    {
+        // Find the character size that was drawn the longest time ago
+        bool found = false;
+        unsigned int evictedSize = 0;
+        std::uint64_t oldestUse = 0;
+        for (const auto& texturePage : m_texturePages)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
-            const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            for (const auto& row : texturePage.rows)
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
+                if ((row.characterSize == 0) || (row.characterSize == characterSizeInUse))
+                    continue;
 
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+                // Glyphs that were used in the current frame may already be part of vertices that haven't been rendered yet
+                const auto it = m_characterSizeLastUsed.find(row.characterSize);
+                const std::uint64_t lastUse = (it != m_characterSizeLastUsed.end()) ? it->second : 0;
+                if (lastUse > m_frameStartUseCounter)
+                    continue;
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
+                if (!found || (lastUse < oldestUse))
                 {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
+                    found = true;
+                    evictedSize = row.characterSize;
+                    oldestUse = lastUse;
                 }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
+            }
+        }
+
+        if (!found)
+            return false;
+
+        // Free all rows that contained glyphs of this size. The pixels are cleared because glyphs are placed with padding
+        // around them that is assumed to be transparent.
+        for (unsigned int pageIndex = 0; pageIndex < m_texturePages.size(); ++pageIndex)
+        {
+            TexturePage& texturePage = m_texturePages[pageIndex];
+            bool pageEmpty = true;
+            for (auto& row : texturePage.rows)
+            {
+                if (row.characterSize == evictedSize)
                 {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
+                    clearAtlasPixels(&texturePage.pixels[static_cast<std::size_t>(row.top) * texturePage.size * m_bytesPerPixel],
+                                     static_cast<std::size_t>(row.height) * texturePage.size, m_bytesPerPixel);
+                    addDirtyRect(texturePage.texture, texturePage.dirtyRect, {0, row.top, texturePage.size, row.height});
+
+                    row.characterSize = 0;
+                    row.width = 0;
                 }
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+                if (row.characterSize != 0)
+                    pageEmpty = false;
             }
 
-            // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+            // If no glyphs are left on the page then forget about the rows, so that the space can be divided differently
+            if (pageEmpty)
+            {
+                texturePage.rows.clear();
+                texturePage.nextRow = 3;
+            }
+        }
+
+        for (auto it = m_glyphs.begin(); it != m_glyphs.end();)
+        {
+            if (it->second.characterSize == evictedSize)
+                it = m_glyphs.erase(it);
+            else
+                ++it;
+        }
+
+        m_characterSizeLastUsed.erase(evictedSize);
+
+        // The texture rects of the Latin-1 glyphs are no longer valid. Kerning is lost as well, but it is cheap to recalculate.
+        for (const bool bold : {false, true})
+        {
+            const unsigned int sizeCacheKey = (evictedSize << 1) | (bold ? 1u : 0u);
+            if (m_lastSizeCache && (m_lastSizeCacheKey == sizeCacheKey))
+                m_lastSizeCache = nullptr;
+
+            m_sizeCaches.erase(sizeCacheKey);
+        }
+
+        // Texts that used the evicted glyphs have to reload them
+        ++m_textureVersion;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::markCharacterSizeUsed(unsigned int characterSize)
+    {
+        const std::uint64_t frameNumber = isBackendSet() ? getBackend()->getFrameNumber() : 0;
+        if (frameNumber != m_frameNumber)
+        {
+            m_frameNumber = frameNumber;
+            m_frameStartUseCounter = m_useCounter;
+        }
+
+        m_characterSizeLastUsed[characterSize] = ++m_useCounter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getTexturePageSizeLimit() const
+    {
+        unsigned int limit = m_maxTexturePageSize;
+        if (isBackendSet() && getBackend()->hasRenderer())
+        {
+            const unsigned int maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+            if ((maxTextureSize > 0) && ((limit == 0) || (maxTextureSize < limit)))
+                limit = maxTextureSize;
         }
 
-        // Find the glyph's rectangle on the selected row
-        UIntRect rect{bestRow->width, bestRow->top, width, height};
+        // Pick a size that is supported by any hardware if we don't know the maximum size yet
+        if (limit == 0)
+            limit = 4096;
+
+        return limit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::loadAtlasTexture(unsigned int page)
+    {
+        TexturePage& texturePage = m_texturePages[page];
+        if (m_bytesPerPixel == 1)
+        {
+            if (texturePage.texture->loadAlphaTextureOnly({texturePage.size, texturePage.size}, texturePage.pixels.get(), m_isSmooth))
+                return;
+
+            // The renderer claimed to support alpha textures but the texture didn't, so convert the atlas to RGBA pixels
+            for (auto& otherPage : m_texturePages)
+            {
+                const std::size_t pixelCount = static_cast<std::size_t>(otherPage.size) * otherPage.size;
+                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount * 4);
+                for (std::size_t i = 0; i < pixelCount; ++i)
+                {
+                    pixels[i * 4 + 0] = 255;
+                    pixels[i * 4 + 1] = 255;
+                    pixels[i * 4 + 2] = 255;
+                    pixels[i * 4 + 3] = otherPage.pixels[i];
+                }
+
+                otherPage.pixels = std::move(pixels);
+            }
+
+            m_bytesPerPixel = 4;
+        }
 
-        // Update the row informations
-        bestRow->width += width;
-        return rect;
+        texturePage.texture->loadTextureOnly({texturePage.size, texturePage.size}, texturePage.pixels.get(), m_isSmooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,8 +31,10 @@
 #include <raylib.h>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <numeric>
     #include <cmath>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +47,9 @@ namespace tgui
     {
         m_cachedAscents.clear();
         m_glyphs.clear();
+        m_rows.clear();
+        m_texture = nullptr;
+        m_dirtyRect = {};
         m_nextRow = 3; // First 2 rows contain pixels for underlining
 
         constexpr unsigned int initialTextureSize = 128;
@@ -258,6 +263,12 @@ namespace tgui
 
     std::shared_ptr<BackendTexture> BackendFontRaylib::getTexture(unsigned int, unsigned int& textureVersion)
     {
+        // If glyphs were added since the texture was last uploaded then only upload the part of the texture that changed.
+        // If the backend doesn't support partial updates then upload the entire image again. The size of the texture
+        // remains the same, so the texture can still be reused and the texture coordinates of texts remain valid.
+        if (!uploadDirtyRect(m_texture, m_dirtyRect, m_pixels.get(), m_textureSize, 4))
+            m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+
         if (m_texture)
         {
             textureVersion = m_textureVersion;
@@ -296,8 +307,8 @@ namespace tgui
 
         BackendFont::setFontScale(scale);
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // Force texts to update their glyphs. The texture itself doesn't change, so it doesn't have to be recreated.
+        ++m_textureVersion;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,8 +401,9 @@ namespace tgui
                     }
                 }
 
-                // We will have to recreate the texture now that the pixels changed
-                m_texture = nullptr;
+                // Only the part of the texture that contains the new glyph will have to be uploaded again
+                addDirtyRect(m_texture, m_dirtyRect, {glyph.textureRect.left - padding, glyph.textureRect.top - padding,
+                                                      glyph.textureRect.width + (2 * padding), glyph.textureRect.height + (2 * padding)});
             }
         }
 
@@ -465,6 +477,10 @@ namespace tgui
 
                 m_pixels = std::move(pixels);
                 m_textureSize *= 2;
+
+                // The texture coordinates change when the size changes, so we need a new texture
+                m_texture = nullptr;
+                m_dirtyRect = {};
             }
 
             // We can now create the new row
@@ -30,6 +30,11 @@
 
 #include <cassert>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -55,6 +60,7 @@ namespace tgui
         m_texture = nullptr;
         m_textureSize = 0;
         m_textureVersion = 0;
+        m_dirtyRect = {};
         m_nextRow = 3; // First 2 rows contain pixels for underlining
 
         constexpr unsigned int initialTextureSize = 128;
@@ -196,8 +202,9 @@ namespace tgui
                     }
                 }
 
-                // We will have to recreate the texture now that the pixels changed
-                m_texture = nullptr;
+                // Only the part of the texture that contains the new glyph will have to be uploaded again
+                addDirtyRect(m_texture, m_dirtyRect, {glyph.textureRect.left - padding, glyph.textureRect.top - padding,
+                                                      glyph.textureRect.width + (2 * padding), glyph.textureRect.height + (2 * padding)});
             }
 
             SDL_DestroySurface(surface);
@@ -306,6 +313,12 @@ namespace tgui
 
     std::shared_ptr<BackendTexture> BackendFontSDLttf::getTexture(unsigned int, unsigned int& textureVersion)
     {
+        // If glyphs were added since the texture was last uploaded then only upload the part of the texture that changed.
+        // If the backend doesn't support partial updates then upload the entire image again. The size of the texture
+        // remains the same, so the texture can still be reused and the texture coordinates of texts remain valid.
+        if (!uploadDirtyRect(m_texture, m_dirtyRect, m_pixels.get(), m_textureSize, 4))
+            m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+
         if (m_texture)
         {
             textureVersion = m_textureVersion;
@@ -384,8 +397,8 @@ namespace tgui
 
         BackendFont::setFontScale(scale);
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // Force texts to update their glyphs. The texture itself doesn't change, so it doesn't have to be recreated.
+        ++m_textureVersion;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -518,6 +531,10 @@ namespace tgui
 
                 m_pixels = std::move(pixels);
                 m_textureSize *= 2;
+
+                // The texture coordinates change when the size changes, so we need a new texture
+                m_texture = nullptr;
+                m_dirtyRect = {};
             }
 
             // We can now create the new row
@@ -92,10 +92,12 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
         const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+        for (auto& vertices : m_vertices)
+        {
+            for (auto& vertex : *vertices)
+                vertex.color = vertexColor;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,11 +121,11 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        if (m_outlineVertices)
+        const Vertex::Color vertexColor(color);
+        for (auto& vertices : m_outlineVertices)
         {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
+            for (auto& vertex : *vertices)
+                vertex.color = vertexColor;
         }
     }
 
@@ -241,8 +243,7 @@ namespace tgui
             return data;
 
         unsigned int textureVersion;
-        auto texture = m_font->getTexture(m_characterSize, textureVersion);
-        if (!texture)
+        if (!m_font->getTexturePage(0, m_characterSize, textureVersion))
             return data;
 
         // If the font texture changes then we need to update the texture coordinates
@@ -250,18 +251,23 @@ namespace tgui
             m_verticesNeedUpdate = true;
 
         if (m_verticesNeedUpdate)
-        {
             updateVertices();
 
-            // It is possible that the texture changes during the update
-            texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
-        }
-
-        if (m_outlineVertices && !m_outlineVertices->empty())
-            data.emplace_back(texture, m_outlineVertices);
+        // The textures are only requested after the update, because loading glyphs can change them.
+        // The outlines are returned first so that the glyphs on any page are drawn on top of them.
+        for (const auto* pages : {&m_outlineVertices, &m_vertices})
+        {
+            for (unsigned int page = 0; page < pages->size(); ++page)
+            {
+                const auto& vertices = (*pages)[page];
+                if (vertices->empty())
+                    continue;
 
-        if (m_vertices && !m_vertices->empty())
-            data.emplace_back(texture, m_vertices);
+                auto texture = m_font->getTexturePage(page, m_characterSize, m_lastFontTextureVersion);
+                if (texture)
+                    data.emplace_back(std::move(texture), vertices);
+            }
+        }
 
         return data;
     }
@@ -275,15 +281,12 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
-        if (!m_vertices)
-            m_vertices = std::make_shared<std::vector<Vertex>>();
-        if (!m_outlineVertices && (m_outlineThickness != 0))
-            m_outlineVertices = std::make_shared<std::vector<Vertex>>();
+        for (auto& vertices : m_vertices)
+            vertices->clear();
+        for (auto& vertices : m_outlineVertices)
+            vertices->clear();
 
         m_size = {0, 0};
-        m_vertices->clear();
-        if (m_outlineVertices)
-            m_outlineVertices->clear();
 
         if (m_characterSize == 0)
             return;
@@ -327,19 +330,19 @@ namespace tgui
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+                addLine(getPageVertices(m_vertices, 0), x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(getPageVertices(m_outlineVertices, 0), x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             // If we're using the strike through style and there's a new line, draw a line across all characters
             if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+                addLine(getPageVertices(m_vertices, 0), x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(getPageVertices(m_outlineVertices, 0), x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             prevChar = curChar;
@@ -373,7 +376,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(getPageVertices(m_outlineVertices, glyph.texturePage), {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -381,7 +384,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(getPageVertices(m_vertices, glyph.texturePage), {x, y}, vertexFillColor, glyph, fontScale, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -396,19 +399,19 @@ namespace tgui
         // If we're using the underlined style, add the last line
         if (isUnderlined && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+            addLine(getPageVertices(m_vertices, 0), x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(getPageVertices(m_outlineVertices, 0), x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // If we're using the strike through style, add the last line across all characters
         if (isStrikeThrough && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+            addLine(getPageVertices(m_vertices, 0), x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(getPageVertices(m_outlineVertices, 0), x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // The height of a line can sometimes be slightly larger than the line spacing returned by the font.
@@ -418,21 +421,18 @@ namespace tgui
 
         m_size = {maxX + 2 * m_outlineThickness, height + 2 * m_outlineThickness};
 
-        // Normalize the texture coordinates
-        const Vector2u textureSize = m_font->getTextureSize(m_characterSize);
-        if ((textureSize.x > 0) && (textureSize.y > 0))
+        // Normalize the texture coordinates, each page of the font can have a different texture size
+        for (const auto* pages : {&m_vertices, &m_outlineVertices})
         {
-            const float textureWidth = static_cast<float>(textureSize.x);
-            const float textureHeight = static_cast<float>(textureSize.y);
-
-            for (auto& vertex : *m_vertices)
-            {
-                vertex.texCoords.x /= textureWidth;
-                vertex.texCoords.y /= textureHeight;
-            }
-            if (m_outlineVertices)
+            for (unsigned int page = 0; page < pages->size(); ++page)
             {
-                for (auto& vertex : *m_outlineVertices)
+                const Vector2u textureSize = m_font->getTexturePageSize(page, m_characterSize);
+                if ((textureSize.x == 0) || (textureSize.y == 0))
+                    continue;
+
+                const float textureWidth = static_cast<float>(textureSize.x);
+                const float textureHeight = static_cast<float>(textureSize.y);
+                for (auto& vertex : *(*pages)[page])
                 {
                     vertex.texCoords.x /= textureWidth;
                     vertex.texCoords.y /= textureHeight;
@@ -443,6 +443,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<Vertex>& BackendText::getPageVertices(std::vector<std::shared_ptr<std::vector<Vertex>>>& pages, unsigned int page)
+    {
+        while (pages.size() <= page)
+            pages.push_back(std::make_shared<std::vector<Vertex>>());
+
+        return *pages[page];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float fontScale, float italicShear)
     {
         const float padding = 1;
@@ -24,10 +24,16 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    BackendTexture::PixelRetention BackendTexture::m_defaultPixelRetention = BackendTexture::PixelRetention::Full;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
@@ -37,7 +43,12 @@ namespace tgui
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        if (m_pixelRetention == PixelRetention::Full)
+            m_pixels = std::move(pixels);
+        else if (m_pixelRetention == PixelRetention::AlphaMask)
+            createTransparencyMask(pixels.get());
+
+        m_storedPixels = m_pixelRetention;
         return true;
     }
 
@@ -47,14 +58,31 @@ namespace tgui
     {
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
-        m_pixels = nullptr;
+        clearStoredPixels();
         m_imageSize = size;
         m_isSmooth = smooth;
+        m_isAlphaTexture = false;
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::loadAlphaTextureOnly(Vector2u, const std::uint8_t*, bool)
+    {
+        // Single-channel textures have to be implemented by the backend, the caller will have to use RGBA pixels instead
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updatePixels(UIntRect, const std::uint8_t*)
+    {
+        // Partial updates have to be implemented by the backend, the caller will have to reload the entire texture
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -76,15 +104,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::isAlphaTexture() const
+    {
+        return m_isAlphaTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_pixels && !m_transparencyMask)
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        const auto pixelIndex = pixel.y * m_imageSize.x + pixel.x;
+        if (m_pixels)
+            return (m_pixels[pixelIndex * 4 + 3] == 0);
+        else
+            return ((m_transparencyMask[pixelIndex / 8] >> (pixelIndex % 8)) & 1) != 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +133,116 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setPixelRetention(PixelRetention retention)
+    {
+        m_pixelRetention = retention;
+        if (retention >= m_storedPixels)
+            return;
+
+        // Reduce the information that is already stored
+        if ((retention == PixelRetention::AlphaMask) && m_pixels)
+            createTransparencyMask(m_pixels.get());
+        else
+            m_transparencyMask = nullptr;
+
+        m_pixels = nullptr;
+        m_storedPixels = retention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelRetention BackendTexture::getPixelRetention() const
+    {
+        return m_pixelRetention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDefaultPixelRetention(PixelRetention retention)
+    {
+        m_defaultPixelRetention = retention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTexture::PixelRetention BackendTexture::getDefaultPixelRetention()
+    {
+        return m_defaultPixelRetention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::updateStoredPixels(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region passed to BackendTexture::updatePixels has to lie inside the texture");
+
+        if (m_storedPixels == PixelRetention::AlphaMask)
+        {
+            updateTransparencyMask(region, pixels);
+            return;
+        }
+
+        if (!m_pixels)
+            return;
+
+        const unsigned int bytesPerPixel = m_isAlphaTexture ? 1 : 4;
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            std::memcpy(&m_pixels[(((region.top + y) * m_imageSize.x) + region.left) * bytesPerPixel],
+                        &pixels[y * region.width * bytesPerPixel],
+                        region.width * bytesPerPixel);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::clearStoredPixels()
+    {
+        m_pixels = nullptr;
+        m_transparencyMask = nullptr;
+        m_storedPixels = PixelRetention::None;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::createTransparencyMask(const std::uint8_t* pixels)
+    {
+        m_transparencyMask = nullptr;
+        updateTransparencyMask({0, 0, m_imageSize.x, m_imageSize.y}, pixels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::updateTransparencyMask(UIntRect region, const std::uint8_t* pixels)
+    {
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            for (unsigned int x = 0; x < region.width; ++x)
+            {
+                const bool transparent = (pixels[((y * region.width) + x) * 4 + 3] == 0);
+
+                // The mask is only allocated once a transparent pixel is found, an opaque image doesn't need it
+                if (!m_transparencyMask)
+                {
+                    if (!transparent)
+                        continue;
+
+                    m_transparencyMask = std::make_unique<std::uint8_t[]>((m_imageSize.x * m_imageSize.y + 7) / 8);
+                }
+
+                const unsigned int pixelIndex = ((region.top + y) * m_imageSize.x) + region.left + x;
+                const auto bit = static_cast<std::uint8_t>(1u << (pixelIndex % 8));
+                if (transparent)
+                    m_transparencyMask[pixelIndex / 8] |= bit;
+                else
+                    m_transparencyMask[pixelIndex / 8] &= static_cast<std::uint8_t>(~bit);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
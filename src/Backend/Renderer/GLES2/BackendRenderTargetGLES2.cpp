@@ -66,11 +66,15 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool uAlphaTexture;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uAlphaTexture)\n"
+                "        texColor.rgb = vec3(1.0);\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -92,11 +96,15 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool uAlphaTexture;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uAlphaTexture)\n"
+                "        texColor.rgb = vec3(1.0);\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -118,10 +126,14 @@ namespace tgui
                 "#version 100\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool uAlphaTexture;\n"
                 "varying vec4 color;\n"
                 "varying vec2 texCoord;\n"
                 "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                "    if (uAlphaTexture)\n"
+                "        texColor.rgb = vec3(1.0);\n"
+                "    gl_FragColor = texColor * color;\n"
                 "}";
         }
 
@@ -187,6 +199,9 @@ namespace tgui
                 throw Exception{U"Failed to initialize BackendRenderTargetGLES2: projectionMatrix uniform wasn't found in shader program"};
         }
 
+        // Single-channel textures (e.g. glyph atlases) are created with GL_ALPHA, which has black as color
+        m_alphaTextureShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uAlphaTexture");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             const int positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -308,6 +323,8 @@ namespace tgui
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        TGUI_GL_CHECK(glUniform1i(m_alphaTextureShaderUniformLocation, 0));
+        m_currentTextureIsAlpha = false;
 
         // Draw the widgets
         root->draw(*this, {});
@@ -361,6 +378,13 @@ namespace tgui
                 m_currentTexture = nullptr;
                 TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
             }
+
+            const bool isAlphaTexture = m_currentTexture && m_currentTexture->isAlphaTexture();
+            if (m_currentTextureIsAlpha != isAlphaTexture)
+            {
+                m_currentTextureIsAlpha = isAlphaTexture;
+                TGUI_GL_CHECK(glUniform1i(m_alphaTextureShaderUniformLocation, isAlphaTexture ? 1 : 0));
+            }
         }
 
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
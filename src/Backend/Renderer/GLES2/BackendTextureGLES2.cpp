@@ -45,51 +45,43 @@ namespace tgui
 
     bool BackendTextureGLES2::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
     {
-        TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
-        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+        return loadTexture(size, pixels, smooth, false);
+    }
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        BackendTexture::loadTextureOnly(size, pixels, smooth);
+    bool BackendTextureGLES2::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        return loadTexture(size, pixels, smooth, true);
+    }
 
-        if (!reuseTexture)
-        {
-            if (m_textureId != 0)
-                TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
-        }
+    bool BackendTextureGLES2::updatePixels(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (m_textureId == 0)
+            return false;
+
+        updateStoredPixels(region, pixels);
 
         GLint oldBoundTexture;
         TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
 
-        if (reuseTexture)
+        GLint oldUnpackAlignment = 4;
+        if (m_isAlphaTexture)
         {
-            if (pixels)
-                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
         }
-        else
-        {
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
 
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      m_isAlphaTexture ? GL_ALPHA : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
 
-            if (TGUI_GLAD_GL_ES_VERSION_3_0)
-            {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
-                if (pixels)
-                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            }
-            else
-            {
-                // GLES 2.0 doesn't support GL_RGBA8
-                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            }
-        }
+        if (m_isAlphaTexture)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
 
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
@@ -127,6 +119,79 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::loadTexture(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly)
+    {
+        TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
+        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y)
+                                && (smooth == m_isSmooth) && (alphaOnly == m_isAlphaTexture));
+
+        BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_isAlphaTexture = alphaOnly;
+
+        if (!reuseTexture)
+        {
+            if (m_textureId != 0)
+                TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+
+            TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
+        }
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+
+        // Rows of single-channel textures aren't necessarily aligned to 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        if (reuseTexture)
+        {
+            if (pixels)
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), alphaOnly ? GL_ALPHA : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+
+            if (alphaOnly)
+            {
+                // GL_ALPHA is supported by all GLES versions, but it can't be used with glTexStorage2D
+                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels));
+            }
+            else if (TGUI_GLAD_GL_ES_VERSION_3_0)
+            {
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                if (pixels)
+                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+            }
+            else
+            {
+                // GLES 2.0 doesn't support GL_RGBA8
+                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+            }
+        }
+
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
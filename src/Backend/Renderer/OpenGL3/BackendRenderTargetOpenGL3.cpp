@@ -32,6 +32,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <numeric>
 #endif
 
@@ -81,11 +82,15 @@ namespace tgui
         {
             "#version 330 core\n"
             "uniform sampler2D uTexture;\n"
+            "uniform bool uAlphaTexture;\n"
             "in vec4 color;\n"
             "in vec2 texCoord;\n"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            "    vec4 texColor = texture(uTexture, texCoord);\n"
+            "    if (uAlphaTexture)\n"
+            "        texColor = vec4(1.0, 1.0, 1.0, texColor.r);\n"
+            "    outColor = texColor * color;\n"
             "}"
         };
 
@@ -141,6 +146,9 @@ namespace tgui
         if (!TGUI_GLAD_GL_VERSION_4_3)
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
 
+        // Single-channel textures (e.g. glyph atlases) store their coverage in the red channel
+        m_alphaTextureShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uAlphaTexture");
+
         createBuffers();
 
         // Create a solid white 1x1 texture to pass to the shader when we aren't drawing a texture
@@ -239,14 +247,39 @@ namespace tgui
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
+        m_scissorRect = viewportGL;
+        m_appliedScissorRect = viewportGL;
+        m_drawStatistics = {};
+
         // Don't make any assumptions about the currently set texture
-        m_currentTexture = nullptr;
-        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_currentTextureId = m_emptyTexture->getInternalTexture();
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTextureId));
+        TGUI_GL_CHECK(glUniform1i(m_alphaTextureShaderUniformLocation, 0));
+        m_currentTextureIsAlpha = false;
+
+        m_batchingActive = m_batchingEnabled;
+        if (m_batchingActive)
+        {
+            // The vertices are already transformed on the CPU, so the projection only has to be uploaded once per frame
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+            // Orphan the streaming buffers so that we never have to wait for the GPU to finish the previous frame
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferSize), nullptr, GL_STREAM_DRAW));
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_indexBufferSize), nullptr, GL_STREAM_DRAW));
+            m_vertexBufferOffset = 0;
+            m_indexBufferOffset = 0;
+        }
 
         // Draw the widgets
         root->draw(*this, {});
 
-        m_currentTexture = nullptr;
+        if (m_batchingActive)
+        {
+            flushBatch();
+            m_batchingActive = false;
+        }
+
+        m_currentTextureId = 0;
 
         // Restore the old state
         TGUI_GL_CHECK(glBindVertexArray(0));
@@ -279,26 +312,19 @@ namespace tgui
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
+        ++m_drawStatistics.drawRequests;
+
+        if (m_batchingActive)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
-
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
-            }
-            else
-            {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
-            }
+            addToBatch(states, vertices, vertexCount, indices, indexCount, texture);
+            return;
         }
 
+        bindTexture(texture);
+
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // Batch rendering (see setBatchingEnabled) is much faster though.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
 
         const Transform finalTransform = m_projectionTransform * states.transform;
@@ -313,6 +339,35 @@ namespace tgui
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
             TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+
+        ++m_drawStatistics.drawCalls;
+        m_drawStatistics.vertices += vertexCount;
+
+        // The buffers were resized, the streaming buffers will have to be reallocated when switching to batching
+        m_vertexBufferSize = 0;
+        m_indexBufferSize = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setBatchingEnabled(bool batchingEnabled)
+    {
+        TGUI_ASSERT(!m_batchingActive, "BackendRenderTargetOpenGL3::setBatchingEnabled can't be called while drawing the gui");
+        m_batchingEnabled = batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTargetOpenGL3::DrawStatistics BackendRenderTargetOpenGL3::getDrawStatistics() const
+    {
+        return m_drawStatistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,16 +377,21 @@ namespace tgui
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
-
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            m_scissorRect = {static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
+                             static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)};
         }
         else // Clip the entire window
         {
             m_pixelsPerPoint = {1, 1};
-
-            TGUI_GL_CHECK(glScissor(0, 0, 0, 0));
+            m_scissorRect = {0, 0, 0, 0};
         }
+
+        // When batching, the scissor rectangle is only applied when the batch that uses it gets flushed
+        if (m_batchingActive)
+            return;
+
+        TGUI_GL_CHECK(glScissor(m_scissorRect[0], m_scissorRect[1], m_scissorRect[2], m_scissorRect[3]));
+        m_appliedScissorRect = m_scissorRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,6 +428,110 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::addToBatch(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                                const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (!m_batchIndices.empty() && ((m_batchTexture != texture) || (m_batchScissorRect != m_scissorRect)))
+            flushBatch();
+
+        m_batchTexture = texture;
+        m_batchScissorRect = m_scissorRect;
+
+        // Pre-apply the transformation, so that all vertices in the batch can share the same projection matrix
+        const auto baseIndex = static_cast<unsigned int>(m_batchVertices.size());
+        m_batchVertices.reserve(m_batchVertices.size() + vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+            m_batchVertices.emplace_back(states.transform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords);
+
+        if (indices)
+        {
+            m_batchIndices.reserve(m_batchIndices.size() + indexCount);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(baseIndex + indices[i]);
+        }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+        {
+            m_batchIndices.resize(m_batchIndices.size() + vertexCount);
+            std::iota(m_batchIndices.end() - static_cast<std::ptrdiff_t>(vertexCount), m_batchIndices.end(), baseIndex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::flushBatch()
+    {
+        if (m_batchIndices.empty())
+            return;
+
+        bindTexture(m_batchTexture);
+
+        if (m_appliedScissorRect != m_batchScissorRect)
+        {
+            TGUI_GL_CHECK(glScissor(m_batchScissorRect[0], m_batchScissorRect[1], m_batchScissorRect[2], m_batchScissorRect[3]));
+            m_appliedScissorRect = m_batchScissorRect;
+        }
+
+        // Only orphan the buffers when the new data no longer fits behind the data that was already written this frame.
+        // Writing to non-overlapping ranges means the driver doesn't have to synchronize with the draw calls that are in flight.
+        const std::size_t vertexBytes = m_batchVertices.size() * sizeof(Vertex);
+        const std::size_t indexBytes = m_batchIndices.size() * sizeof(GLuint);
+        if ((m_vertexBufferOffset + vertexBytes > m_vertexBufferSize) || (m_indexBufferOffset + indexBytes > m_indexBufferSize))
+        {
+            m_vertexBufferSize = std::max<std::size_t>({m_vertexBufferSize, vertexBytes, 1 << 20});
+            m_indexBufferSize = std::max<std::size_t>({m_indexBufferSize, indexBytes, 1 << 18});
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferSize), nullptr, GL_STREAM_DRAW));
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_indexBufferSize), nullptr, GL_STREAM_DRAW));
+            m_vertexBufferOffset = 0;
+            m_indexBufferOffset = 0;
+        }
+
+        TGUI_GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(m_vertexBufferOffset),
+                                      static_cast<GLsizeiptr>(vertexBytes), m_batchVertices.data()));
+        TGUI_GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLintptr>(m_indexBufferOffset),
+                                      static_cast<GLsizeiptr>(indexBytes), m_batchIndices.data()));
+
+        TGUI_GL_CHECK(glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_INT,
+                                               reinterpret_cast<GLvoid*>(m_indexBufferOffset),
+                                               static_cast<GLint>(m_vertexBufferOffset / sizeof(Vertex))));
+
+        m_vertexBufferOffset += vertexBytes;
+        m_indexBufferOffset += indexBytes;
+
+        ++m_drawStatistics.flushes;
+        ++m_drawStatistics.drawCalls;
+        m_drawStatistics.vertices += m_batchVertices.size();
+
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        m_batchTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::bindTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        TGUI_ASSERT(!texture || std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+        const BackendTextureOpenGL3* textureGL = texture ? static_cast<const BackendTextureOpenGL3*>(texture.get()) : m_emptyTexture.get();
+
+        // The OpenGL texture is compared instead of the texture object, because reloading a texture with a different size
+        // replaces the OpenGL texture that belongs to the object.
+        const unsigned int textureId = textureGL->getInternalTexture();
+        if (m_currentTextureId != textureId)
+        {
+            m_currentTextureId = textureId;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureId));
+        }
+
+        const bool isAlphaTexture = textureGL->isAlphaTexture();
+        if (m_currentTextureIsAlpha != isAlphaTexture)
+        {
+            m_currentTextureIsAlpha = isAlphaTexture;
+            TGUI_GL_CHECK(glUniform1i(m_alphaTextureShaderUniformLocation, isAlphaTexture ? 1 : 0));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +79,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureRaylib::updatePixels(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture.id)
+            return false;
+
+        updateStoredPixels(region, pixels);
+
+        const Rectangle rect{static_cast<float>(region.left), static_cast<float>(region.top),
+                             static_cast<float>(region.width), static_cast<float>(region.height)};
+        UpdateTextureRec(m_texture, rect, pixels);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureRaylib::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -108,7 +123,7 @@ namespace tgui
         }
 
         m_texture = texture;
-        m_pixels = nullptr;
+        clearStoredPixels();
         m_imageSize = {static_cast<unsigned int>(texture.width), static_cast<unsigned int>(texture.height)};
         m_isSmooth = false; // Raylib has no way to query the TextureFilter, assuming it is TEXTURE_FILTER_POINT
     }
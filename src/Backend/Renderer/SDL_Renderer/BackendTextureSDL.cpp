@@ -137,6 +137,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updatePixels(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        updateStoredPixels(region, pixels);
+
+        const SDL_Rect rect{static_cast<int>(region.left), static_cast<int>(region.top), static_cast<int>(region.width), static_cast<int>(region.height)};
+        SDL_UpdateTexture(m_texture, &rect, pixels, static_cast<int>(region.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -163,7 +177,7 @@ namespace tgui
             SDL_DestroyTexture(m_texture);
 
         m_texture = texture;
-        m_pixels = nullptr;
+        clearStoredPixels();
 
 #if SDL_MAJOR_VERSION >= 3
         float width;
@@ -69,6 +69,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updatePixels(UIntRect region, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        updateStoredPixels(region, pixels);
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture->update(pixels, {region.width, region.height}, {region.left, region.top});
+#else
+        m_texture->update(pixels, region.width, region.height, region.left, region.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
@@ -96,7 +113,7 @@ namespace tgui
     {
         m_texture = std::make_unique<sf::Texture>(texture);
 
-        m_pixels = nullptr;
+        clearStoredPixels();
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
     }
@@ -27,6 +27,7 @@
 #include <TGUI/Timer.hpp>
 #include <TGUI/Font.hpp>
 #include <TGUI/DefaultFont.hpp>
+#include <TGUI/SvgImage.hpp>
 #include <TGUI/Backend/Font/BackendFontFactory.hpp>
 #include <TGUI/Backend/Renderer/BackendRenderer.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
@@ -272,6 +273,43 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Backend::updateSvgTextures()
+    {
+        if (!SvgImage::uploadFinishedRasterizations(false))
+            return false;
+
+        for (auto* sprite : m_registeredSvgSprites)
+            sprite->updatePendingSvgTexture();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::waitForSvgRasterizations()
+    {
+        SvgImage::uploadFinishedRasterizations(true);
+
+        for (auto* sprite : m_registeredSvgSprites)
+            sprite->updatePendingSvgTexture();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::startFrame()
+    {
+        ++m_frameNumber;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t Backend::getFrameNumber() const
+    {
+        return m_frameNumber;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/SvgImage.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct BackendGui::PostedTask
+    {
+        std::function<void()> func;
+        PostedTask* next;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendGui::BackendGui()
     {
         m_container->setParentGui(this);
@@ -54,6 +63,15 @@ namespace tgui
 
         if (isBackendSet())
             getBackend()->detatchGui(this);
+
+        // Tasks that were never executed still need to be freed
+        PostedTask* task = m_postedTasks.exchange(nullptr);
+        while (task)
+        {
+            PostedTask* nextTask = task->next;
+            delete task;
+            task = nextTask;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +124,28 @@ namespace tgui
 
     bool BackendGui::handleEvent(Event event)
     {
+        ++m_handledEventCount;
+
+        if (m_mouseMoveCoalescingEnabled)
+        {
+            if (event.type == Event::Type::MouseMoved)
+            {
+                // Only remember the position, the widgets are informed when a different event arrives or when the gui is drawn
+                if (m_mouseMovePending)
+                    ++m_coalescedMouseMoveCount;
+
+                m_mouseMovePending = true;
+                m_lastMousePos = {event.mouseMove.x, event.mouseMove.y};
+                return false;
+            }
+
+            // The widgets need to know where the mouse is before they handle any other event
+            flushPendingMouseMove();
+        }
+
+        // Widgets have to be at their final position before we can find out which one is below the mouse
+        updateLayouts();
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
@@ -145,7 +185,10 @@ namespace tgui
                 m_tooltipPossible = true;
 
                 if (event.type == Event::Type::MouseMoved)
+                {
+                    ++m_dispatchedMouseMoveCount;
                     return m_container->processMouseMoveEvent(mouseCoords);
+                }
                 else if (event.type == Event::Type::MouseWheelScrolled)
                 {
                     if (m_container->processScrollEvent(event.mouseWheel.delta, mouseCoords, false))
@@ -220,6 +263,292 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setMouseMoveCoalescingEnabled(bool enabled)
+    {
+        if (!enabled)
+            flushPendingMouseMove();
+
+        m_mouseMoveCoalescingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isMouseMoveCoalescingEnabled() const
+    {
+        return m_mouseMoveCoalescingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::flushPendingMouseMove()
+    {
+        if (!m_mouseMovePending)
+            return false;
+
+        m_mouseMovePending = false;
+
+        Event event;
+        event.type = Event::Type::MouseMoved;
+        event.mouseMove.x = m_lastMousePos.x;
+        event.mouseMove.y = m_lastMousePos.y;
+
+        // Temporarily disable coalescing, otherwise handleEvent would just store the event again
+        m_mouseMoveCoalescingEnabled = false;
+        const bool eventHandled = handleEvent(event);
+        m_mouseMoveCoalescingEnabled = true;
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getDispatchedMouseMoveCount() const
+    {
+        return m_dispatchedMouseMoveCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getCoalescedMouseMoveCount() const
+    {
+        return m_coalescedMouseMoveCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setDeferredLayoutEnabled(bool enabled)
+    {
+        if (m_deferredLayoutEnabled && !enabled)
+            updateLayouts();
+
+        m_deferredLayoutEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isDeferredLayoutEnabled() const
+    {
+        return m_deferredLayoutEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::updateLayouts()
+    {
+        // Signal handlers that move widgets will simply add them to the queue that we are already processing
+        if (m_updatingLayouts)
+            return;
+
+        m_updatingLayouts = true;
+
+        // Each pass processes the widgets that were changed by the previous pass, so the amount of passes only depends on how
+        // long the chain of dependent layouts is. A layout that (indirectly) depends on itself would never finish.
+        const unsigned int maxPasses = 1000;
+        unsigned int passes = 0;
+        while (!m_deferredLayoutQueue.empty() || !m_deferredLayoutSignalWidgets.empty())
+        {
+            while (!m_deferredLayoutQueue.empty())
+            {
+                if (++passes > maxPasses)
+                {
+                    TGUI_PRINT_WARNING("BackendGui::updateLayouts stopped after " << maxPasses << " passes, layouts seem to depend on each other in a loop.");
+                    for (Widget* widget : m_deferredLayoutQueue)
+                    {
+                        if (widget)
+                            widget->cancelDeferredLayout();
+                    }
+                    for (Widget* widget : m_deferredLayoutSignalWidgets)
+                    {
+                        if (widget)
+                            widget->cancelDeferredLayout();
+                    }
+
+                    m_deferredLayoutQueue.clear();
+                    m_deferredLayoutSignalWidgets.clear();
+                    m_updatingLayouts = false;
+                    return;
+                }
+
+                m_deferredLayoutBatch.swap(m_deferredLayoutQueue);
+                for (std::size_t i = 0; i < m_deferredLayoutBatch.size(); ++i)
+                {
+                    if (m_deferredLayoutBatch[i])
+                        m_deferredLayoutBatch[i]->updateDeferredLayout();
+                }
+                m_deferredLayoutBatch.clear();
+            }
+
+            // The signals are only send once all layouts are up-to-date. The handlers can destroy widgets or move them again,
+            // so we can't iterate over the list with iterators and there may be new layout changes to process afterwards.
+            for (std::size_t i = 0; i < m_deferredLayoutSignalWidgets.size(); ++i)
+            {
+                Widget* const widget = m_deferredLayoutSignalWidgets[i];
+                if (!widget)
+                    continue;
+
+                m_deferredLayoutSignalWidgets[i] = nullptr;
+                widget->emitDeferredLayoutSignals();
+            }
+            m_deferredLayoutSignalWidgets.clear();
+        }
+
+        m_updatingLayouts = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendGui::queueDeferredLayoutUpdate(Widget* widget)
+    {
+        m_deferredLayoutQueue.push_back(widget);
+        return m_deferredLayoutQueue.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendGui::queueDeferredLayoutSignals(Widget* widget)
+    {
+        m_deferredLayoutSignalWidgets.push_back(widget);
+        return m_deferredLayoutSignalWidgets.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::forgetDeferredLayoutWidget(Widget* widget, std::size_t updateIndex, std::size_t signalsIndex)
+    {
+        // The batch is the queue that was swapped out by updateLayouts, so the widget keeps its index when it is moved into it.
+        // An index may be outdated when the widget is no longer in that list, which is why the pointer at the index is checked.
+        if ((updateIndex < m_deferredLayoutQueue.size()) && (m_deferredLayoutQueue[updateIndex] == widget))
+            m_deferredLayoutQueue[updateIndex] = nullptr;
+        if ((updateIndex < m_deferredLayoutBatch.size()) && (m_deferredLayoutBatch[updateIndex] == widget))
+            m_deferredLayoutBatch[updateIndex] = nullptr;
+        if ((signalsIndex < m_deferredLayoutSignalWidgets.size()) && (m_deferredLayoutSignalWidgets[signalsIndex] == widget))
+            m_deferredLayoutSignalWidgets[signalsIndex] = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::post(std::function<void()> task)
+    {
+        auto* newTask = new PostedTask{std::move(task), m_postedTasks.load(std::memory_order_relaxed)};
+        while (!m_postedTasks.compare_exchange_weak(newTask->next, newTask, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        wakeUpMainLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::runPostedTasks()
+    {
+        // Take all tasks from the list at once, so that other threads can continue adding tasks while we execute them
+        PostedTask* task = m_postedTasks.exchange(nullptr, std::memory_order_acquire);
+        if (!task)
+            return false;
+
+        // The list contains the newest task first, so we reverse it to execute the tasks in the order they were posted
+        std::vector<std::unique_ptr<PostedTask>> tasks;
+        while (task)
+        {
+            tasks.emplace_back(task);
+            task = task->next;
+        }
+
+        for (auto it = tasks.rbegin(); it != tasks.rend(); ++it)
+            (*it)->func();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::wakeUpMainLoop()
+    {
+        // The mutex is locked to make certain that the notification can't arrive between checking for tasks and starting to wait
+        {
+            const std::lock_guard<std::mutex> lock(m_wakeUpMutex);
+        }
+        m_wakeUpCondition.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::waitForPostedTasks(Duration maxDuration)
+    {
+        std::unique_lock<std::mutex> lock(m_wakeUpMutex);
+        m_wakeUpCondition.wait_for(lock, std::chrono::nanoseconds(maxDuration), [this]{ return m_postedTasks.load(std::memory_order_relaxed) != nullptr; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::scheduleUpdate(Duration delay)
+    {
+        const auto updateTime = std::chrono::steady_clock::now() + std::chrono::nanoseconds(delay);
+        if (updateTime < m_scheduledUpdateTime)
+            m_scheduledUpdateTime = updateTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> BackendGui::getTimeUntilNextUpdate() const
+    {
+        Optional<Duration> timeUntilUpdate = Timer::getNextScheduledTime();
+        const auto updateBefore = [&timeUntilUpdate](Duration duration){
+            if (duration < Duration{})
+                duration = Duration{};
+            if (!timeUntilUpdate || (duration < *timeUntilUpdate))
+                timeUntilUpdate = duration;
+        };
+
+        if (m_scheduledUpdateTime != std::chrono::steady_clock::time_point::max())
+            updateBefore(m_scheduledUpdateTime - std::chrono::steady_clock::now());
+
+        if (m_tooltipPossible && !m_visibleToolTip)
+            updateBefore(ToolTip::getInitialDelay() - m_tooltipTime);
+
+        // Svg images that are rasterized in the background can't wake up the gui, so we keep checking whether they are finished
+        if (SvgImage::getPendingRasterizationCount() > 0)
+            updateBefore(std::chrono::milliseconds(15));
+
+        return timeUntilUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> BackendGui::getMainLoopWaitTime(bool refreshRequired, std::chrono::steady_clock::time_point lastRenderTime) const
+    {
+        if (!refreshRequired)
+            return getTimeUntilNextUpdate();
+
+        // Don't try to render too often, even when the screen is changing (e.g. during animation)
+        const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+        const auto timePointNow = std::chrono::steady_clock::now();
+        if (timePointNextAllowed <= timePointNow)
+            return Duration{};
+
+        const Duration timeUntilRender = timePointNextAllowed - timePointNow;
+        const Optional<Duration> timeUntilUpdate = getTimeUntilNextUpdate();
+        if (timeUntilUpdate && (*timeUntilUpdate < timeUntilRender))
+            return timeUntilUpdate;
+        else
+            return timeUntilRender;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getMainLoopWakeUpCount() const
+    {
+        return m_mainLoopWakeUpCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getMainLoopFrameCount() const
+    {
+        return m_mainLoopFrameCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendGui::setTabKeyUsageEnabled(bool enabled)
     {
         m_tabKeyUsageEnabled = enabled;
@@ -236,9 +565,20 @@ namespace tgui
 
     void BackendGui::draw()
     {
+        flushPendingMouseMove();
+
         if (m_drawUpdatesTime)
             updateTime();
 
+        updateLayouts();
+
+        // Textures that finished rasterizing in the background have to be uploaded on the thread that draws
+        if (isBackendSet())
+        {
+            getBackend()->updateSvgTextures();
+            getBackend()->startFrame();
+        }
+
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
         m_backendRenderTarget->drawGui(m_container);
     }
@@ -521,11 +861,11 @@ namespace tgui
 
     bool BackendGui::updateTime()
     {
-        const auto timePointNow = std::chrono::steady_clock::now();
+        bool screenRefreshRequired = runPostedTasks();
 
-        bool screenRefreshRequired = false;
+        const auto timePointNow = std::chrono::steady_clock::now();
         if (m_lastUpdateTime > std::chrono::steady_clock::time_point())
-            screenRefreshRequired = updateTime(timePointNow - m_lastUpdateTime);
+            screenRefreshRequired |= updateTime(timePointNow - m_lastUpdateTime);
 
         m_lastUpdateTime = timePointNow;
         return screenRefreshRequired;
@@ -535,12 +875,25 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
+        // Widgets that still need to be updated later will request it again while updating
+        m_scheduledUpdateTime = std::chrono::steady_clock::time_point::max();
+
         bool screenRefreshRequired = Timer::updateTime(elapsedTime);
 
+        // Sprites need to be redrawn when the svg image that was being rasterized in the background becomes available
+        if (isBackendSet() && getBackend()->updateSvgTextures())
+            screenRefreshRequired = true;
+
         if (!m_windowFocused)
             return screenRefreshRequired;
 
-        screenRefreshRequired |= m_container->updateTime(elapsedTime);
+        // Widgets that changed may still be changing, e.g. custom widgets that animate themselves without calling scheduleUpdate.
+        // So we keep updating every frame until no widget reports a change anymore.
+        if (m_container->updateTime(elapsedTime))
+        {
+            screenRefreshRequired = true;
+            scheduleUpdate(std::chrono::milliseconds(15));
+        }
 
         if (m_tooltipPossible)
         {
@@ -26,8 +26,6 @@
 #include <TGUI/Backend/Window/GLFW/BackendGLFW.hpp>
 
 #if !TGUI_BUILD_AS_CXX_MODULE
-    #include <TGUI/Timer.hpp>
-
     #ifdef TGUI_SYSTEM_WINDOWS
         #include <TGUI/WindowsIMM.hpp>
     #endif
@@ -424,29 +422,51 @@ namespace tgui
             static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->cursorEnterCallback(entered);
         });
 
+        glfwSetWindowRefreshCallback(m_window, [](GLFWwindow* window) {
+            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->m_redrawRequested = true;
+        });
+
         setDrawingUpdatesTime(false);
 
+        bool refreshRequired = true;
+        std::uint64_t lastHandledEventCount = m_handledEventCount;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!glfwWindowShouldClose(m_window))
         {
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            if (refreshRequired && (std::chrono::steady_clock::now() >= lastRenderTime + std::chrono::milliseconds(15)))
             {
                 m_backendRenderTarget->clearScreen();
                 draw();
                 glfwSwapBuffers(m_window);
-                lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+
+                ++m_mainLoopFrameCount;
+                refreshRequired = false;
+                lastRenderTime = std::chrono::steady_clock::now(); // Don't use the time from before drawing to provide enough rest on low-end hardware
             }
 
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
+            // Sleep until an event arrives or until a timer, animation or screen refresh requires the gui to be updated.
+            // Tasks posted from other threads wake up the loop with glfwPostEmptyEvent.
+            const Optional<Duration> waitTime = getMainLoopWaitTime(refreshRequired, lastRenderTime);
+            if (!waitTime)
+                glfwWaitEvents();
+            else if (*waitTime > Duration{})
+                glfwWaitEventsTimeout(static_cast<double>(waitTime->asSeconds()));
+            else
+                glfwPollEvents();
+
+            ++m_mainLoopWakeUpCount;
+
+            // Events are handled inside the callbacks, so we only know that they occurred by looking at the event counter
+            if (flushPendingMouseMove() || (m_handledEventCount != lastHandledEventCount) || m_redrawRequested)
+                refreshRequired = true;
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
-            updateTime();
+            lastHandledEventCount = m_handledEventCount;
+            m_redrawRequested = false;
+
+            // This also executes the tasks that were posted from other threads
+            if (updateTime())
+                refreshRequired = true;
         }
     }
 
@@ -500,6 +520,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiGLFW::wakeUpMainLoop()
+    {
+        BackendGui::wakeUpMainLoop();
+        glfwPostEmptyEvent();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
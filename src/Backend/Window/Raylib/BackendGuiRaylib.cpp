@@ -238,6 +238,7 @@ namespace tgui
         while (!WindowShouldClose() && !m_endMainLoop)
         {
             handleEvents();
+            flushPendingMouseMove();
 
             int pressedChar = GetCharPressed();
             while (pressedChar)
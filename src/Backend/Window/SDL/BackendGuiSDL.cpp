@@ -27,12 +27,9 @@
 
 #include <TGUI/extlibs/IncludeSDL.hpp>
 
-#if !TGUI_BUILD_AS_CXX_MODULE
-    #include <TGUI/Timer.hpp>
-#endif
-
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
-    #include <thread>
+    #include <algorithm>
+    #include <climits>
     #include <cmath>
 #endif
 
@@ -497,14 +494,12 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
+        // Register a custom event that is pushed when a task is posted from another thread, so that SDL_WaitEventTimeout returns.
+        // SDL_RegisterEvents returns 0 on failure in SDL3 and (Uint32)-1 in SDL2, in which case we can't wait indefinitely.
+        static const Uint32 wakeUpEventType = SDL_RegisterEvents(1);
+        const bool wakeUpEventRegistered = (wakeUpEventType != 0) && (wakeUpEventType != static_cast<Uint32>(-1));
+        if (wakeUpEventRegistered)
+            m_wakeUpEventType = wakeUpEventType;
 
         setDrawingUpdatesTime(false);
 
@@ -513,69 +508,93 @@ namespace tgui
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!quit)
         {
+            // Sleep until an event arrives or until a timer, animation or screen refresh requires the gui to be updated
+            Optional<Duration> waitTime = getMainLoopWaitTime(refreshRequired, lastRenderTime);
+            if (!wakeUpEventRegistered && (!waitTime || (*waitTime > std::chrono::milliseconds(10))))
+                waitTime = Duration{std::chrono::milliseconds(10)};
+
+            SDL_Event event;
+            bool eventAvailable;
+            if (!waitTime)
+                eventAvailable = (SDL_WaitEvent(&event) != 0);
+            else if (*waitTime > Duration{})
+            {
+                // Round the timeout up, waking up before the timer expires would only cause a second wake-up
+                const std::int64_t timeoutMs = (static_cast<std::int64_t>(std::chrono::nanoseconds(*waitTime).count()) + 999999) / 1000000;
+                eventAvailable = (SDL_WaitEventTimeout(&event, static_cast<int>(std::min<std::int64_t>(timeoutMs, INT_MAX))) != 0);
+            }
+            else
+                eventAvailable = (SDL_PollEvent(&event) != 0);
+
+            ++m_mainLoopWakeUpCount;
+
             bool eventProcessed = false;
-            while (true)
+            while (eventAvailable)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
-                SDL_Event event;
-                while (SDL_PollEvent(&event) != 0)
+                if (handleEvent(event))
+                    eventProcessed = true;
+
+                if (event.type == SDL_EVENT_QUIT)
                 {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_EVENT_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
+                    quit = true;
+                    eventProcessed = true;
+                }
 #if SDL_MAJOR_VERSION >= 3
-                    else if ((event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) || (event.type == SDL_EVENT_WINDOW_EXPOSED)
-                          || (event.type == SDL_EVENT_WINDOW_MOUSE_ENTER) || (event.type == SDL_EVENT_WINDOW_MOUSE_LEAVE)
-                          || (event.type == SDL_EVENT_WINDOW_FOCUS_GAINED) || (event.type == SDL_EVENT_WINDOW_FOCUS_LOST))
+                else if ((event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) || (event.type == SDL_EVENT_WINDOW_EXPOSED)
+                      || (event.type == SDL_EVENT_WINDOW_MOUSE_ENTER) || (event.type == SDL_EVENT_WINDOW_MOUSE_LEAVE)
+                      || (event.type == SDL_EVENT_WINDOW_FOCUS_GAINED) || (event.type == SDL_EVENT_WINDOW_FOCUS_LOST))
 #else
-                    else if ((event.type == SDL_WINDOWEVENT)
-                          && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)
-                           || (event.window.event == SDL_WINDOWEVENT_ENTER) || (event.window.event == SDL_WINDOWEVENT_LEAVE)
-                           || (event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED) || (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST)))
+                else if ((event.type == SDL_WINDOWEVENT)
+                      && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)
+                       || (event.window.event == SDL_WINDOWEVENT_ENTER) || (event.window.event == SDL_WINDOWEVENT_LEAVE)
+                       || (event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED) || (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST)))
 #endif
-                    {
-                        eventProcessed = true;
-                    }
+                {
+                    eventProcessed = true;
                 }
 
-                if (updateTime())
-                    break;
-
-                if (eventProcessed || refreshRequired)
-                    break;
-
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                eventAvailable = (SDL_PollEvent(&event) != 0);
             }
 
-            refreshRequired = true;
+            if (flushPendingMouseMove())
+                eventProcessed = true;
 
-            // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed > timePointNow)
-            {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
+            // This also executes the tasks that were posted from other threads
+            if (updateTime() || eventProcessed)
+                refreshRequired = true;
 
+            // Don't try to render too often, even when the screen is changing (e.g. during animation).
+            // If it is too early then the next wait time will be limited to the time until we are allowed to render.
+            if (!refreshRequired || (std::chrono::steady_clock::now() < lastRenderTime + std::chrono::milliseconds(15)))
                 continue;
-            }
 
             m_backendRenderTarget->clearScreen();
             draw();
             presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
 
+            ++m_mainLoopFrameCount;
             refreshRequired = false;
-            lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+            lastRenderTime = std::chrono::steady_clock::now();
         }
+
+        m_wakeUpEventType = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiSDL::wakeUpMainLoop()
+    {
+        BackendGui::wakeUpMainLoop();
+
+        const Uint32 wakeUpEventType = m_wakeUpEventType;
+        if (wakeUpEventType == 0)
+            return;
+
+        // SDL_PushEvent is thread-safe, the event itself is ignored by handleEvent
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = wakeUpEventType;
+        SDL_PushEvent(&event);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
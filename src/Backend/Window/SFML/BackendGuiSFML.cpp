@@ -27,7 +27,6 @@
 
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/ToolTip.hpp>
-    #include <TGUI/Timer.hpp>
 
     #ifdef TGUI_SYSTEM_WINDOWS
         #include <TGUI/WindowsIMM.hpp>
@@ -257,9 +256,10 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
+        // Helper function that calculates the amount of time to sleep, which is 10ms unless the gui needs to be updated before this time.
+        // SFML can't block until an event arrives or another thread wakes it up, so we still have to poll for events.
+        const auto getTimerWakeUpTime = [this]{
+            const Optional<Duration> duration = getTimeUntilNextUpdate();
             if (duration && (*duration < std::chrono::milliseconds(10)))
                 return *duration;
             else
@@ -276,6 +276,8 @@ namespace tgui
             bool eventProcessed = false;
             while (true)
             {
+                ++m_mainLoopWakeUpCount;
+
 #if SFML_VERSION_MAJOR >= 3
                 while (const auto event = m_window->pollEvent())
                 {
@@ -320,13 +322,17 @@ namespace tgui
                     }
                 }
 #endif
+                if (flushPendingMouseMove())
+                    eventProcessed = true;
+
                 if (updateTime())
                     break;
 
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // Sleep, but wake up immediately when a task is posted from another thread
+                waitForPostedTasks(getTimerWakeUpTime());
             }
 
             if (!windowOpen)
@@ -352,6 +358,7 @@ namespace tgui
             draw();
             m_window->display();
 
+            ++m_mainLoopFrameCount;
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
         }
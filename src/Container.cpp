@@ -31,7 +31,11 @@
 #include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <fstream>
+    #include <iterator>
+    #include <numeric>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,8 +95,7 @@ namespace tgui
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    auto rendererRootNode = DataIO::parse(ObjectConverter{pair.second}.getString().toStdString());
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
@@ -169,7 +172,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_spatialIndexEnabled{other.m_spatialIndexEnabled}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -193,7 +197,8 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_spatialIndexEnabled     {std::move(other.m_spatialIndexEnabled)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -230,6 +235,7 @@ namespace tgui
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
             m_draggingWidget = false;
+            m_spatialIndexEnabled = right.m_spatialIndexEnabled;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -263,6 +269,8 @@ namespace tgui
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
             m_draggingWidget           = std::move(right.m_draggingWidget);
+            m_spatialIndexEnabled      = std::move(right.m_spatialIndexEnabled);
+            m_spatialIndexValid        = false;
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -310,6 +318,8 @@ namespace tgui
         if (!widgetName.empty())
             widgetPtr->setWidgetName(widgetName);
 
+        invalidateSpatialIndex();
+
         widgetAdded(widgetPtr);
 
         if (widgetPtr->getAutoLayout() != AutoLayout::Manual)
@@ -394,6 +404,7 @@ namespace tgui
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidateSpatialIndex();
 
             if (widget->getAutoLayout() != AutoLayout::Manual)
                 updateChildrenWithAutoLayout();
@@ -415,6 +426,7 @@ namespace tgui
             widget->setParent(nullptr);
 
         m_widgets.clear();
+        invalidateSpatialIndex();
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -458,9 +470,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open '" + filenameInResources + U"' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        const auto rootNode = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -706,6 +716,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widgetToMove);
+        invalidateSpatialIndex();
 
         if (widgetToMove->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
@@ -766,31 +777,79 @@ namespace tgui
 
         pos -= widgetsOffset;
 
-        for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
-        {
-            const auto& widget = *it;
+        // Look for a visible widget below the mouse
+        const auto isWidgetAtPos = [pos, this](const Widget::Ptr& widget){
+            return widget->isVisible() && !widget->getIgnoreMouseEvents() && widget->isMouseOnWidget(transformMousePos(widget, pos));
+        };
 
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible() || widget->getIgnoreMouseEvents())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
-
-            // If the widget is a container then look inside it if we are looking for the leaf widget
-            if (recursive && widget->isContainer())
+        Widget::Ptr widgetAtPos;
+        if (m_spatialIndexEnabled)
+        {
+            const auto& candidates = getSpatialIndexCandidates(pos);
+            for (auto it = candidates.crbegin(); it != candidates.crend(); ++it)
+            {
+                if (isWidgetAtPos(m_widgets[*it]))
+                {
+                    widgetAtPos = m_widgets[*it];
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
             {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPos(transformMousePos(widget, pos) - container->getPosition(), true);
-                if (childWidget)
-                    return childWidget;
+                if (isWidgetAtPos(*it))
+                {
+                    widgetAtPos = *it;
+                    break;
+                }
             }
+        }
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
+        // If the widget is a container then look inside it if we are looking for the leaf widget
+        if (recursive && widgetAtPos && widgetAtPos->isContainer())
+        {
+            Container::Ptr container = std::static_pointer_cast<Container>(widgetAtPos);
+            auto childWidget = container->getWidgetAtPos(transformMousePos(widgetAtPos, pos) - container->getPosition(), true);
+            if (childWidget)
+                return childWidget;
         }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget.
+        // If no visible widgets were found at the queried position then this returns a nullptr.
+        return widgetAtPos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        m_spatialIndexEnabled = enabled;
+        if (!enabled)
+        {
+            // Release the memory that was used by the index
+            m_spatialIndexCellStarts = {};
+            m_spatialIndexCellWidgets = {};
+            m_spatialIndexUnboundedWidgets = {};
+            m_spatialIndexCandidates = {};
+        }
+
+        m_spatialIndexValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateSpatialIndex()
+    {
+        m_spatialIndexValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1354,6 +1413,27 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::updateChildrenWithAutoLayout()
+    {
+        if (isLayoutDeferred())
+            queueDeferredLayoutChanges(DeferredChildrenAutoLayout);
+        else
+            placeChildrenWithAutoLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateDeferredLayout()
+    {
+        const bool updateChildren = (m_deferredLayoutChanges & DeferredChildrenAutoLayout) != 0;
+        Widget::updateDeferredLayout();
+
+        if (updateChildren)
+            placeChildrenWithAutoLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::placeChildrenWithAutoLayout()
     {
         // If all children have a manual layout then we don't need to do anything
         bool allChildrenUseManualLayout = true;
@@ -1451,6 +1531,24 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        if (m_spatialIndexEnabled)
+        {
+            const auto& candidates = getSpatialIndexCandidates(mousePos);
+            for (auto it = candidates.crbegin(); it != candidates.crend(); ++it)
+            {
+                const auto& widget = m_widgets[*it];
+                if (!widget->isVisible() || widget->getIgnoreMouseEvents())
+                    continue;
+
+                if (!widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                    continue;
+
+                return widget;
+            }
+
+            return nullptr;
+        }
+
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
         {
             const auto& widget = *it;
@@ -1588,6 +1686,126 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::vector<std::size_t>& Container::getSpatialIndexCandidates(Vector2f pos) const
+    {
+        // Derived classes may have changed m_widgets directly, so the amount of widgets is always checked
+        if (!m_spatialIndexValid || (m_spatialIndexWidgetCount != m_widgets.size()))
+            rebuildSpatialIndex();
+
+        m_spatialIndexCandidates.clear();
+
+        auto cellWidgetsBegin = m_spatialIndexCellWidgets.cbegin();
+        auto cellWidgetsEnd = m_spatialIndexCellWidgets.cbegin();
+        if (m_spatialIndexBounds.contains(pos))
+        {
+            const auto column = std::min(static_cast<std::size_t>((pos.x - m_spatialIndexBounds.left) / m_spatialIndexCellSize), m_spatialIndexColumns - 1);
+            const auto row = std::min(static_cast<std::size_t>((pos.y - m_spatialIndexBounds.top) / m_spatialIndexCellSize), m_spatialIndexRows - 1);
+            const std::size_t cell = (row * m_spatialIndexColumns) + column;
+            cellWidgetsBegin += static_cast<std::ptrdiff_t>(m_spatialIndexCellStarts[cell]);
+            cellWidgetsEnd += static_cast<std::ptrdiff_t>(m_spatialIndexCellStarts[cell + 1]);
+        }
+
+        // Both lists are sorted, so merging them keeps the widgets ordered from back to front
+        std::merge(cellWidgetsBegin, cellWidgetsEnd,
+                   m_spatialIndexUnboundedWidgets.cbegin(), m_spatialIndexUnboundedWidgets.cend(),
+                   std::back_inserter(m_spatialIndexCandidates));
+        return m_spatialIndexCandidates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex() const
+    {
+        m_spatialIndexValid = true;
+        m_spatialIndexWidgetCount = m_widgets.size();
+        m_spatialIndexBounds = {};
+        m_spatialIndexCellStarts.clear();
+        m_spatialIndexCellWidgets.clear();
+        m_spatialIndexUnboundedWidgets.clear();
+
+        // Calculate the bounding box of each widget. Rotated or scaled widgets aren't placed in the grid.
+        std::vector<FloatRect> widgetBounds(m_widgets.size());
+        std::vector<std::size_t> boundedWidgets;
+        boundedWidgets.reserve(m_widgets.size());
+        Vector2f minPos;
+        Vector2f maxPos;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const auto& widget = m_widgets[i];
+            if ((widget->getScale().x != 1) || (widget->getScale().y != 1) || (widget->getRotation() != 0))
+            {
+                m_spatialIndexUnboundedWidgets.push_back(i);
+                continue;
+            }
+
+            const Vector2f size = widget->getSize();
+            const Vector2f fullSize = widget->getFullSize();
+            const Vector2f topLeft = widget->getPosition() - Vector2f{widget->getOrigin().x * size.x, widget->getOrigin().y * size.y};
+            const Vector2f fullTopLeft = topLeft + widget->getWidgetOffset();
+            const Vector2f boundsMin{std::min(topLeft.x, fullTopLeft.x), std::min(topLeft.y, fullTopLeft.y)};
+            const Vector2f boundsMax{std::max(topLeft.x + size.x, fullTopLeft.x + fullSize.x), std::max(topLeft.y + size.y, fullTopLeft.y + fullSize.y)};
+            if (!std::isfinite(boundsMin.x) || !std::isfinite(boundsMin.y) || !std::isfinite(boundsMax.x) || !std::isfinite(boundsMax.y))
+            {
+                m_spatialIndexUnboundedWidgets.push_back(i);
+                continue;
+            }
+
+            widgetBounds[i] = {boundsMin, boundsMax - boundsMin};
+            if (boundedWidgets.empty())
+            {
+                minPos = boundsMin;
+                maxPos = boundsMax;
+            }
+            else
+            {
+                minPos = {std::min(minPos.x, boundsMin.x), std::min(minPos.y, boundsMin.y)};
+                maxPos = {std::max(maxPos.x, boundsMax.x), std::max(maxPos.y, boundsMax.y)};
+            }
+
+            boundedWidgets.push_back(i);
+        }
+
+        if (boundedWidgets.empty())
+            return;
+
+        // Choose the cell size so that there are about as many cells as there are widgets.
+        // The amount of rows and columns is limited in case there are widgets that are very far apart.
+        const Vector2f gridSize = maxPos - minPos;
+        const float maxCellsPerAxis = 1024;
+        m_spatialIndexCellSize = std::sqrt(gridSize.x * gridSize.y / static_cast<float>(boundedWidgets.size()));
+        m_spatialIndexCellSize = std::max({m_spatialIndexCellSize, gridSize.x / maxCellsPerAxis, gridSize.y / maxCellsPerAxis, 16.f});
+        m_spatialIndexColumns = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(gridSize.x / m_spatialIndexCellSize)));
+        m_spatialIndexRows = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(gridSize.y / m_spatialIndexCellSize)));
+        m_spatialIndexBounds = {minPos, {static_cast<float>(m_spatialIndexColumns) * m_spatialIndexCellSize,
+                                         static_cast<float>(m_spatialIndexRows) * m_spatialIndexCellSize}};
+
+        const auto forEachCell = [this](const FloatRect& bounds, const std::function<void(std::size_t)>& func){
+            const auto firstColumn = static_cast<std::size_t>((bounds.left - m_spatialIndexBounds.left) / m_spatialIndexCellSize);
+            const auto firstRow = static_cast<std::size_t>((bounds.top - m_spatialIndexBounds.top) / m_spatialIndexCellSize);
+            const auto lastColumn = std::min(static_cast<std::size_t>((bounds.left + bounds.width - m_spatialIndexBounds.left) / m_spatialIndexCellSize), m_spatialIndexColumns - 1);
+            const auto lastRow = std::min(static_cast<std::size_t>((bounds.top + bounds.height - m_spatialIndexBounds.top) / m_spatialIndexCellSize), m_spatialIndexRows - 1);
+            for (std::size_t row = firstRow; row <= lastRow; ++row)
+            {
+                for (std::size_t column = firstColumn; column <= lastColumn; ++column)
+                    func((row * m_spatialIndexColumns) + column);
+            }
+        };
+
+        // Count the widgets in each cell and then fill the cells. Widgets are added in order, so each cell remains sorted.
+        m_spatialIndexCellStarts.assign((m_spatialIndexColumns * m_spatialIndexRows) + 1, 0);
+        for (const std::size_t i : boundedWidgets)
+            forEachCell(widgetBounds[i], [this](std::size_t cell){ ++m_spatialIndexCellStarts[cell + 1]; });
+
+        std::partial_sum(m_spatialIndexCellStarts.begin(), m_spatialIndexCellStarts.end(), m_spatialIndexCellStarts.begin());
+
+        std::vector<std::size_t> cellFillPos(m_spatialIndexCellStarts.begin(), m_spatialIndexCellStarts.end() - 1);
+        m_spatialIndexCellWidgets.resize(m_spatialIndexCellStarts.back());
+        for (const std::size_t i : boundedWidgets)
+            forEachCell(widgetBounds[i], [this, i, &cellFillPos](std::size_t cell){ m_spatialIndexCellWidgets[cellFillPos[cell]++] = i; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::widgetAdded(const Widget::Ptr& widgetPtr)
     {
         if (widgetPtr->getParent())
@@ -64,6 +64,7 @@ namespace tgui
         ~FileDialogIconLoaderLinux() override;
 
         TGUI_NODISCARD bool update() override;
+        TGUI_NODISCARD bool isLoading() const override;
         TGUI_NODISCARD bool supportsSystemIcons() const override;
         TGUI_NODISCARD bool hasGenericIcons() const override;
         TGUI_NODISCARD Texture getGenericFileIcon(const Filesystem::FileInfo& file) override;
@@ -213,6 +214,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialogIconLoaderLinux::isLoading() const
+    {
+        return m_preloadLookupTablesThreadStarted || m_loadFileIconsThreadStarted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool FileDialogIconLoaderLinux::supportsSystemIcons() const
     {
         return true;
@@ -80,6 +80,7 @@ namespace tgui
         ~FileDialogIconLoaderWindows() override;
 
         TGUI_NODISCARD bool update() override;
+        TGUI_NODISCARD bool isLoading() const override;
         TGUI_NODISCARD bool supportsSystemIcons() const override;
         TGUI_NODISCARD bool hasGenericIcons() const override;
         TGUI_NODISCARD Texture getGenericFileIcon(const Filesystem::FileInfo& file) override;
@@ -238,6 +239,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialogIconLoaderWindows::isLoading() const
+    {
+        return m_threadStarted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool FileDialogIconLoaderWindows::supportsSystemIcons() const
     {
         return true;
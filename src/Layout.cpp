@@ -26,10 +26,36 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <mutex>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Forms often contain the same expression many times (e.g. "parent.width - 20" or "50%"), so parsed expressions are
+        // stored and copied when the same string is encountered again. The stored layouts are never connected to a widget.
+        struct LayoutParseCache
+        {
+            std::mutex mutex;
+            std::unordered_map<std::u32string, Layout> layouts;
+        };
+
+        const std::size_t maxLayoutParseCacheSize = 4096;
+
+        TGUI_NODISCARD LayoutParseCache& getLayoutParseCache()
+        {
+            static LayoutParseCache cache;
+            return cache;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static std::pair<String, String> parseMinMaxExpresssion(const String& expression)
     {
         unsigned int bracketCount = 0;
@@ -68,6 +94,31 @@ namespace tgui
         if (expression.empty())
             return;
 
+        auto& cache = getLayoutParseCache();
+        {
+            const std::lock_guard<std::mutex> lock(cache.mutex);
+            const auto it = cache.layouts.find(expression.toUtf32());
+            if (it != cache.layouts.end())
+            {
+                *this = it->second;
+                return;
+            }
+        }
+
+        // The mutex can't be locked while parsing, as the sub-expressions are parsed by recursively constructing layouts
+        parseExpression(expression);
+
+        const std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.layouts.size() >= maxLayoutParseCacheSize)
+            cache.layouts.clear();
+
+        cache.layouts.emplace(expression.toUtf32(), *this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::parseExpression(const String& expression)
+    {
         auto searchPos = expression.find_first_of("+-/*()");
 
         // Extract the value from the string when there are no more operators
@@ -245,8 +296,8 @@ namespace tgui
             std::advance(nextOperandIt, 1);
 
             (*operandIt) = Layout{operatorToApply,
-                                  std::make_unique<Layout>(*operandIt),
-                                  std::make_unique<Layout>(*nextOperandIt)};
+                                  std::make_unique<Layout>(std::move(*operandIt)),
+                                  std::make_unique<Layout>(std::move(*nextOperandIt))};
 
             operands.erase(nextOperandIt);
         }
@@ -271,20 +322,20 @@ namespace tgui
                 if (operatorToApply == Operation::Minus)
                     nextOperandIt->m_value = -nextOperandIt->m_value;
 
-                *operandIt = *nextOperandIt;
+                *operandIt = std::move(*nextOperandIt);
             }
             else // Normal addition or subtraction
             {
                 *operandIt = Layout{operatorToApply,
-                                    std::make_unique<Layout>(*operandIt),
-                                    std::make_unique<Layout>(*nextOperandIt)};
+                                    std::make_unique<Layout>(std::move(*operandIt)),
+                                    std::make_unique<Layout>(std::move(*nextOperandIt))};
             }
 
             operands.erase(nextOperandIt);
         }
 
         TGUI_ASSERT(operands.size() == 1, "Layout constructor should reduce expression to single result");
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,32 +352,7 @@ namespace tgui
             "Layout constructor with bound widget must be called with an operation that involves the widget"
         );
 
-        // TODO: Try to resolve the code duplicate with recalculateValue()
-        if (m_operation == Operation::BindingPosX)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingPosY)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
+        // The layout has no parent and no callback yet, so recalculateValue will only compute the value
         resetPointers();
         recalculateValue();
     }
@@ -707,14 +733,14 @@ namespace tgui
                 break;
             case Operation::BindingInnerWidth:
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
+                const auto* boundContainer = dynamic_cast<const Container*>(m_boundWidget);
                 if (boundContainer)
                     m_value = boundContainer->getInnerSize().x;
                 break;
             }
             case Operation::BindingInnerHeight:
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
+                const auto* boundContainer = dynamic_cast<const Container*>(m_boundWidget);
                 if (boundContainer)
                     m_value = boundContainer->getInnerSize().y;
                 break;
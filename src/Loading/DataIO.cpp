@@ -23,6 +23,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <TGUI/String.hpp>
 
@@ -31,497 +33,903 @@
 #else
     #include <cctype> // isspace
     #include <algorithm>
+    #include <cstdint>
+    #include <cstring>
+    #include <array>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
-    for (;;) \
-    { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
-            break; \
-        \
-        if (stream.peek() == '/') \
-        { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
-            else \
-                return "Unexpected '/' found."; \
-            \
-            continue; \
-        } \
-        break; \
-    } \
-    \
-    if (stream.peek() == EOF) \
-    { \
-        if (ReturnErrorOnEOF) \
-            return "Unexpected EOF while parsing."; \
-        else \
-            return ""; \
-    }
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 namespace tgui
 {
     namespace
     {
-        // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        TGUI_NODISCARD bool isWhitespace(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        // Characters that can be copied as-is into a word, without needing special handling
+        TGUI_NODISCARD bool isPlainWordChar(char c)
+        {
+            return !isWhitespace(c) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}') && (c != '/') && (c != '"');
+        }
+
+        // Characters that can be copied as-is into a value, without needing special handling
+        TGUI_NODISCARD bool isPlainValueChar(char c)
+        {
+            return !isWhitespace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}') && (c != '/') && (c != '"');
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        // Parses the input directly from a contiguous buffer in a single pass. Runs of characters that need no special handling
+        // are copied at once and each word or value is only converted to a String when it is complete.
+        class Parser
         {
-            String word = "";
-            while (stream.peek() != EOF)
+        public:
+            explicit Parser(CharStringView data) :
+                m_data{data}
+            {
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD bool atEnd() const
+            {
+                return m_pos >= m_data.size();
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD std::size_t getPosition() const
+            {
+                return m_pos;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            String parseRootSection(DataIO::Node& root)
+            {
+                String error;
+                if (!removeWhitespaceAndComments(error, false))
+                    return error;
+
+                String word = readWord();
+                if (word.empty())
+                {
+                    if (!removeWhitespaceAndComments(error, true))
+                        return error;
+                    if (peek() != '{')
+                        return "Expected section name, found '" + String(1, static_cast<char>(peek())) + "' instead.";
+                }
+
+                if (!removeWhitespaceAndComments(error, true))
+                    return error;
+
+                if (peek() == '{')
+                    return parseSection(root, std::move(word));
+                else if (peek() == '=')
+                    return parseKeyValue(root, std::move(word));
+                else if (peek() == ':')
+                    return parseInheritance(root, std::move(word));
+                else
+                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(peek())) + "' instead.";
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            TGUI_NODISCARD int peek() const
+            {
+                if (m_pos < m_data.size())
+                    return static_cast<unsigned char>(m_data[m_pos]);
+                else
+                    return EOF;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Skips until the end of the line or until the end of a block comment. The first '/' was already read.
+            void skipComment()
+            {
+                if (peek() == '/')
+                {
+                    const std::size_t newlinePos = m_data.find('\n', m_pos);
+                    m_pos = (newlinePos != std::string::npos) ? newlinePos + 1 : m_data.size();
+                }
+                else // Block comment, the search for its end starts behind the '*' of the opening "/*"
+                {
+                    const std::size_t endPos = m_data.find("*/", m_pos + 1);
+                    m_pos = (endPos != std::string::npos) ? endPos + 2 : m_data.size();
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Returns false when the end of the input is reached or when a syntax error is found.
+            // The error is only set for a syntax error or when the end of the input was not expected.
+            TGUI_NODISCARD bool removeWhitespaceAndComments(String& error, bool errorOnEOF)
             {
-                char c = static_cast<char>(stream.peek());
-                if (c == '\r')
+                for (;;)
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    while ((m_pos < m_data.size()) && isWhitespace(m_data[m_pos]))
+                        ++m_pos;
+
+                    if (peek() != '/')
+                        break;
+
+                    ++m_pos;
+                    if ((peek() != '/') && (peek() != '*'))
+                    {
+                        error = "Unexpected '/' found.";
+                        return false;
+                    }
+
+                    skipComment();
                 }
-                else if (!std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
+
+                if (peek() == EOF)
                 {
-                    stream.read(&c, 1);
+                    if (errorOnEOF)
+                        error = "Unexpected EOF while parsing.";
+                    return false;
+                }
+
+                return true;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    if ((c == '/') && (stream.peek() == '/'))
+            // Copies a quoted string to the output, the opening quote was already read and added
+            void readQuotedString(std::string& output)
+            {
+                const std::size_t start = m_pos;
+                bool backslash = false;
+                while (m_pos < m_data.size())
+                {
+                    const char c = m_data[m_pos++];
+                    if ((c == '"') && !backslash)
+                        break;
+
+                    backslash = ((c == '\\') && !backslash);
+                }
+
+                output.append(m_data.data() + start, m_pos - start);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD String readWord()
+            {
+                std::string word;
+                while (m_pos < m_data.size())
+                {
+                    const char c = m_data[m_pos];
+                    if (isPlainWordChar(c))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
-                            }
-                        }
+                        const std::size_t start = m_pos;
+                        while ((m_pos < m_data.size()) && isPlainWordChar(m_data[m_pos]))
+                            ++m_pos;
+
+                        word.append(m_data.data() + start, m_pos - start);
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if (c == '\r')
                     {
-                        while (stream.peek() != EOF)
+                        ++m_pos;
+                        return String(word);
+                    }
+                    else if ((c == '/') || (c == '"'))
+                    {
+                        ++m_pos;
+                        if ((c == '/') && (peek() == '/'))
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            skipComment();
+                            if (m_data[m_pos - 1] == '\n')
                             {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
+                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
+                                                           "(comment would have been skipped earlier)");
+                                return String(word);
                             }
                         }
-                    }
-                    else if (c == '"')
-                    {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
+                        else if ((c == '/') && (peek() == '*'))
+                            skipComment();
+                        else if (c == '"')
                         {
-                            stream.read(&c, 1);
                             word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
+                            readQuotedString(word);
                         }
+                        else
+                            word.push_back(c);
                     }
                     else
-                        word.push_back(c);
+                        return String(word);
                 }
-                else
-                    return word;
-            }
 
-            return "";
-        }
+                return "";
+            }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
-        {
-            std::string line;
-            bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            // Reads the value up to the ';' or '}' that ends it, with comments removed and whitespace collapsed.
+            // An empty string is returned when the value isn't properly terminated.
+            TGUI_NODISCARD std::string readLine()
             {
-                char c = static_cast<char>(stream.peek());
-
-                if (c == '/')
+                std::string line;
+                bool whitespaceFound = false;
+                while (m_pos < m_data.size())
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    char c = m_data[m_pos];
+                    if (isPlainValueChar(c))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
+                        const std::size_t start = m_pos;
+                        while ((m_pos < m_data.size()) && isPlainValueChar(m_data[m_pos]))
+                            ++m_pos;
+
+                        line.append(m_data.data() + start, m_pos - start);
+                        whitespaceFound = false;
+                        continue;
                     }
-                    else if (stream.peek() == '*')
+
+                    if (c == '/')
                     {
-                        while (stream.peek() != EOF)
+                        ++m_pos;
+                        if ((peek() == '/') || (peek() == '*'))
+                            skipComment();
+                        else // The slash is part of the value
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
+                            whitespaceFound = false;
+                            line.push_back(c);
                         }
+
                         continue;
                     }
-                    else // The slash is part of the value
-                    {
-                        whitespaceFound = false;
-                        line.push_back(c);
-                    }
-
-                    continue;
-                }
-
-                if (c == '"')
-                {
-                    stream.read(&c, 1);
-                    line.push_back(c);
 
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
+                    if (c == '"')
                     {
-                        stream.read(&c, 1);
+                        ++m_pos;
                         line.push_back(c);
+                        readQuotedString(line);
 
-                        if (c == '"' && !backslash)
-                            break;
+                        if (m_pos >= m_data.size())
+                            return "";
 
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
+                        c = m_data[m_pos];
                     }
 
-                    if (stream.peek() == EOF)
+                    if ((c == '=') || (c == '{'))
                         return "";
-
-                    c = static_cast<char>(stream.peek());
-                }
-
-                if ((c == '=') || (c == '{'))
-                    return "";
-                else if ((c == ';') || (c == '}'))
-                {
-                    // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
-                }
-                else if (::isspace(c))
-                {
-                    stream.read(&c, 1);
-                    if (!whitespaceFound)
+                    else if ((c == ';') || (c == '}'))
                     {
-                        whitespaceFound = true;
-                        line.push_back(' ');
+                        // Remove trailing whitespace before returning the line
+                        line.erase(line.find_last_not_of(" \n\r\t")+1);
+                        return line;
+                    }
+                    else if (isWhitespace(c))
+                    {
+                        ++m_pos;
+                        if (!whitespaceFound)
+                        {
+                            whitespaceFound = true;
+                            line.push_back(' ');
+                        }
+                    }
+                    else
+                    {
+                        whitespaceFound = false;
+                        line.push_back(c);
+                        ++m_pos;
                     }
                 }
-                else
-                {
-                    whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
-                }
+
+                return "";
             }
 
-            return "";
-        }
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            String parseKeyValue(DataIO::Node& node, String key)
+            {
+                // Skip the assignment symbol and the whitespace behind it
+                ++m_pos;
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
-        {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+                String error;
+                if (!removeWhitespaceAndComments(error, true))
+                    return error;
 
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
+                // Check for subsection as value
+                if (peek() == '{')
+                    return parseSection(node, std::move(key));
 
-            // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+                // Read the value
+                String line = String(readLine()).trim();
+                if (line.empty())
+                {
+                    if (peek() == EOF)
+                        return "Found EOF while trying to read a value.";
+                    else if (peek() == '=')
+                        return "Found '=' while trying to read a value.";
+                    else if (peek() == '{')
+                        return "Found '{' while trying to read a value.";
+                    else
+                        return "Found empty value.";
+                }
 
-            // Read the value
-            String line = readLine(stream).trim();
-            if (!line.empty())
-            {
-                // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                // Skip the ';' if it is there
+                if (peek() == ';')
+                    ++m_pos;
 
-                // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
 
-                // It might be a list node
+                // It might be a list node, in which case the elements are separated by commas outside of quotes
                 if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
                 {
                     valueNode->listNode = true;
                     if (line.size() >= 3)
                     {
-                        valueNode->valueList.emplace_back("");
-
+                        std::size_t elementStart = 1;
                         std::size_t i = 1;
                         while (i < line.size()-1)
                         {
                             if (line[i] == ',')
                             {
-                                i++;
-                                valueNode->valueList.back() = valueNode->valueList.back().trim();
-                                valueNode->valueList.emplace_back("");
+                                valueNode->valueList.push_back(line.substr(elementStart, i - elementStart).trim());
+                                ++i;
+                                elementStart = i;
                             }
                             else if (line[i] == '"')
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-                                i++;
+                                ++i;
 
                                 bool backslash = false;
                                 while (i < line.size()-1)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
-                                    if (line[i] == '"' && !backslash)
+                                    if ((line[i] == '"') && !backslash)
                                     {
-                                        i++;
+                                        ++i;
                                         break;
                                     }
 
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
+                                    backslash = ((line[i] == '\\') && !backslash);
+                                    ++i;
                                 }
                             }
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-                                i++;
-                            }
+                                ++i;
                         }
 
-                        valueNode->valueList.back() = valueNode->valueList.back().trim();
+                        valueNode->valueList.push_back(line.substr(elementStart, line.size() - 1 - elementStart).trim());
                     }
                 }
 
-                node->propertyValuePairs[key] = std::move(valueNode);
+                valueNode->value = std::move(line);
+                node.propertyValuePairs[std::move(key)] = std::move(valueNode);
                 return "";
             }
-            else
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            String parseInheritance(DataIO::Node& node, String sectionName)
             {
-                if (stream.peek() == EOF)
-                    return "Found EOF while trying to read a value.";
-                else
+                // Skip the colon
+                ++m_pos;
+
+                String error;
+                if (!removeWhitespaceAndComments(error, true))
+                    return error;
+
+                const String baseSectionName = readWord();
+                if (baseSectionName.empty())
+                    return "Expected name of base section to inherit from after ':'.";
+
+                const DataIO::Node* parentNode = &node;
+                const DataIO::Node* baseSectionNode = nullptr;
+                while (!baseSectionNode && parentNode)
                 {
-                    chr = static_cast<char>(stream.peek());
-                    if (chr == '=')
-                        return "Found '=' while trying to read a value.";
-                    else if (chr == '{')
-                        return "Found '{' while trying to read a value.";
+                    for (const auto& prevSections : parentNode->children)
+                    {
+                        if (prevSections->name != baseSectionName)
+                            continue;
+
+                        baseSectionNode = prevSections.get();
+                        break;
+                    }
+
+                    parentNode = parentNode->parent;
+                }
+
+                if (!baseSectionNode)
+                    return "Failed to find base section '" + baseSectionName + "' to inherit from.";
+
+                if (!removeWhitespaceAndComments(error, true))
+                    return error;
+                if (peek() != '{')
+                    return "Expected '{' after specifying base section to inherit from.";
+
+                error = parseSection(node, std::move(sectionName));
+                if (!error.empty())
+                    return error;
+
+                const auto& sectionNode = node.children.back(); // This node was added by parseSection
+
+                // Copy properties that aren't overwritten
+                for (const auto& pair : baseSectionNode->propertyValuePairs)
+                {
+                    const String& propertyName = pair.first;
+                    if (sectionNode->propertyValuePairs.find(propertyName) == sectionNode->propertyValuePairs.end())
+                        sectionNode->propertyValuePairs[propertyName] = std::make_unique<DataIO::ValueNode>(*pair.second);
+                }
+
+                // Copy children that aren't overwritten
+                for (const auto& baseChildNode : baseSectionNode->children)
+                {
+                    const auto it = std::find_if(sectionNode->children.begin(), sectionNode->children.end(),
+                        [&](const std::unique_ptr<DataIO::Node>& childNode){ return childNode->name == baseChildNode->name; });
+                    if (it == sectionNode->children.end())
+                        sectionNode->children.push_back(std::make_unique<DataIO::Node>(*baseChildNode));
+                }
+
+                return "";
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            String parseSection(DataIO::Node& node, String sectionName)
+            {
+                // Create a new node for this section
+                auto sectionNode = std::make_unique<DataIO::Node>();
+                sectionNode->parent = &node;
+                sectionNode->name = std::move(sectionName);
+
+                // Skip the brace
+                ++m_pos;
+
+                String error;
+                while (m_pos < m_data.size())
+                {
+                    if (!removeWhitespaceAndComments(error, true))
+                        return error;
+
+                    String word = readWord();
+                    if (word.empty())
+                    {
+                        if (peek() == EOF)
+                            return "Found EOF while trying to read property or nested section name.";
+                        else if (peek() == '}')
+                        {
+                            node.children.push_back(std::move(sectionNode));
+                            ++m_pos;
+
+                            // Ignore semicolon behind closing brace
+                            if (!removeWhitespaceAndComments(error, false))
+                                return error;
+                            if (peek() == ';')
+                                ++m_pos;
+
+                            (void)removeWhitespaceAndComments(error, false);
+                            return error;
+                        }
+                        else if (peek() != '{')
+                            return "Expected property or nested section name, found '" + String(1, static_cast<char>(peek())) + "' instead.";
+                    }
+
+                    if (!removeWhitespaceAndComments(error, true))
+                        return error;
+
+                    if (peek() == '{')
+                        error = parseSection(*sectionNode, std::move(word));
+                    else if (peek() == '=')
+                        error = parseKeyValue(*sectionNode, std::move(word));
+                    else if (peek() == ':')
+                        error = parseInheritance(*sectionNode, std::move(word));
                     else
-                        return "Found empty value.";
+                        return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(peek())) + "' instead.";
+
+                    if (!error.empty())
+                        return error;
                 }
+
+                return "Found EOF while reading section.";
             }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        private:
+
+            CharStringView m_data;
+            std::size_t m_pos = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The binary format starts with a header that can't occur in a text file, followed by the root node. Each node is stored
+        // as its name, its properties and its children. Each property value starts with a byte containing its type, followed by
+        // either the text of the value or the already deserialized value. Strings are stored as their length followed by their
+        // UTF-8 characters. All other numbers are stored as 32-bit little endian integers, floats are stored with their bits.
+        constexpr std::array<char, 8> binaryHeader{{'\0', 'T', 'G', 'U', 'I', 'B', 'I', '1'}};
+
+        // Type of the values in the binary format
+        enum class BinaryValueType : std::uint8_t
+        {
+            Text,
+            Bool,
+            Number,
+            Color,
+            Outline,
+            TextStyle,
+            Texture,
+            Font
+        };
+
+        // Each element occupies a minimum amount of bytes in the binary data. This is used to reject element counts that are
+        // larger than what the remaining data could contain, before allocating memory for them.
+        constexpr std::size_t minBinaryStringSize = 4;
+        constexpr std::size_t minBinaryPropertySize = minBinaryStringSize + 1 + 1;
+        constexpr std::size_t minBinaryNodeSize = minBinaryStringSize + 4 + 4;
+
+        // Limit the recursion when reading nodes, so that corrupt data can't cause a stack overflow
+        constexpr unsigned int maxBinaryNodeDepth = 256;
+
+        void writeBinaryNumber(std::string& output, std::size_t value)
+        {
+            TGUI_ASSERT(value <= 0xFFFFFFFFu, "Values in the binary format have to fit in 32 bits");
+            const auto number = static_cast<std::uint32_t>(value);
+            for (unsigned int i = 0; i < 4; ++i)
+                output.push_back(static_cast<char>((number >> (8 * i)) & 0xFF));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseInheritance(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        void writeBinaryFloat(std::string& output, float value)
         {
-            // Read the colon from the stream
-            char chr;
-            stream.read(&chr, 1);
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
+            std::uint32_t bits;
+            static_assert(sizeof(bits) == sizeof(value), "Floats are stored as 32-bit numbers in the binary format");
+            std::memcpy(&bits, &value, sizeof(bits));
+            writeBinaryNumber(output, bits);
+        }
 
-            String baseSectionName = readWord(stream);
-            if (baseSectionName.empty())
-                return "Expected name of base section to inherit from after ':'.";
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            const DataIO::Node* parentNode = node.get();
-            const DataIO::Node* baseSectionNode = nullptr;
-            while (!baseSectionNode && parentNode)
-            {
-                for (const auto& prevSections : parentNode->children)
-                {
-                    if (prevSections->name != baseSectionName)
-                        continue;
+        void writeBinaryRect(std::string& output, const UIntRect& rect)
+        {
+            writeBinaryNumber(output, rect.left);
+            writeBinaryNumber(output, rect.top);
+            writeBinaryNumber(output, rect.width);
+            writeBinaryNumber(output, rect.height);
+        }
 
-                    baseSectionNode = prevSections.get();
-                    break;
-                }
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                parentNode = parentNode->parent;
-            }
+        void writeBinaryString(std::string& output, const String& str)
+        {
+            const std::string utf8 = str.toStdString();
+            writeBinaryNumber(output, utf8.size());
+            output += utf8;
+        }
 
-            if (!baseSectionNode)
-                return "Failed to find base section '" + baseSectionName + "' to inherit from.";
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() != '{')
-                return "Expected '{' after specifying base section to inherit from.";
+        void writeBinaryTextValue(std::string& output, const DataIO::ValueNode& valueNode)
+        {
+            output.push_back(static_cast<char>(BinaryValueType::Text));
+            writeBinaryString(output, valueNode.value);
+            output.push_back(valueNode.listNode ? 1 : 0);
 
-            const auto& error = parseSection(stream, node, sectionName);
-            if (!error.empty())
-                return error;
+            writeBinaryNumber(output, valueNode.valueList.size());
+            for (const auto& listValue : valueNode.valueList)
+                writeBinaryString(output, listValue);
+        }
 
-            const auto& sectionNode = node->children.back(); // This node was added by parseSection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinaryValue(std::string& output, const DataIO::ValueNode& valueNode)
+        {
+            if (!valueNode.typed)
+            {
+                writeBinaryTextValue(output, valueNode);
+                return;
+            }
 
-            // Copy properties that aren't overwritten
-            for (const auto& pair : baseSectionNode->propertyValuePairs)
+            const DataIO::TypedValue& typed = *valueNode.typed;
+            ObjectConverter typedValue = typed.value; // The getters of ObjectConverter aren't const
+            switch (typed.type)
+            {
+            case ObjectConverter::Type::Bool:
+                output.push_back(static_cast<char>(BinaryValueType::Bool));
+                output.push_back(typedValue.getBool() ? 1 : 0);
+                break;
+            case ObjectConverter::Type::Number:
+                output.push_back(static_cast<char>(BinaryValueType::Number));
+                writeBinaryFloat(output, typedValue.getNumber());
+                break;
+            case ObjectConverter::Type::Color:
             {
-                const String& propertyName = pair.first;
-                if (sectionNode->propertyValuePairs.find(propertyName) == sectionNode->propertyValuePairs.end())
-                    sectionNode->propertyValuePairs[propertyName] = std::make_unique<DataIO::ValueNode>(*pair.second);
+                const Color& color = typedValue.getColor();
+                output.push_back(static_cast<char>(BinaryValueType::Color));
+                output.push_back(color.isSet() ? 1 : 0);
+                output.push_back(static_cast<char>(color.getRed()));
+                output.push_back(static_cast<char>(color.getGreen()));
+                output.push_back(static_cast<char>(color.getBlue()));
+                output.push_back(static_cast<char>(color.getAlpha()));
+                break;
+            }
+            case ObjectConverter::Type::Outline:
+            {
+                // Only outlines without relative values are stored as typed values
+                const Outline& outline = typedValue.getOutline();
+                output.push_back(static_cast<char>(BinaryValueType::Outline));
+                writeBinaryFloat(output, outline.getLeft());
+                writeBinaryFloat(output, outline.getTop());
+                writeBinaryFloat(output, outline.getRight());
+                writeBinaryFloat(output, outline.getBottom());
+                break;
+            }
+            case ObjectConverter::Type::TextStyle:
+                output.push_back(static_cast<char>(BinaryValueType::TextStyle));
+                writeBinaryNumber(output, static_cast<unsigned int>(typedValue.getTextStyle()));
+                break;
+            case ObjectConverter::Type::Texture:
+                output.push_back(static_cast<char>(BinaryValueType::Texture));
+                writeBinaryString(output, valueNode.value);
+                writeBinaryRect(output, typed.texturePartRect);
+                writeBinaryRect(output, typed.textureMiddleRect);
+                output.push_back(typed.textureSmooth ? (*typed.textureSmooth ? 1 : 0) : 2);
+                break;
+            case ObjectConverter::Type::Font:
+                output.push_back(static_cast<char>(BinaryValueType::Font));
+                writeBinaryString(output, valueNode.value);
+                break;
+            default:
+                TGUI_ASSERT(false, "Only values with a type supported by the binary format can be typed");
+                writeBinaryTextValue(output, valueNode);
+                break;
             }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinaryNode(std::string& output, const DataIO::Node& node);
+
+        void writeBinaryNodeContents(std::string& output, const DataIO::Node& node)
+        {
+            writeBinaryString(output, node.name);
 
-            // Copy children that aren't overwritten
-            for (const auto& baseChildNode : baseSectionNode->children)
+            writeBinaryNumber(output, node.propertyValuePairs.size());
+            for (const auto& pair : node.propertyValuePairs)
             {
-                const auto it = std::find_if(sectionNode->children.begin(), sectionNode->children.end(),
-                    [&](const std::unique_ptr<DataIO::Node>& childNode){ return childNode->name == baseChildNode->name; });
-                if (it == sectionNode->children.end())
-                    sectionNode->children.push_back(std::make_unique<DataIO::Node>(*baseChildNode));
+                writeBinaryString(output, pair.first);
+                writeBinaryValue(output, *pair.second);
             }
 
-            return "";
+            writeBinaryNumber(output, node.children.size());
+            for (const auto& child : node.children)
+                writeBinaryNode(output, *child);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        void writeBinaryNode(std::string& output, const DataIO::Node& node)
         {
-            // Create a new node for this section
-            auto sectionNode = std::make_unique<DataIO::Node>();
-            sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            // Renderers in forms are stored with deserialized values, so that they don't have to be deserialized when loading
+            if ((node.name == U"Renderer") || node.name.starts_with(U"Renderer."))
+            {
+                DataIO::Node rendererNode{node};
+                RendererData::deserializeDataIONodeValues(rendererNode);
+                writeBinaryNodeContents(output, rendererNode);
+            }
+            else
+                writeBinaryNodeContents(output, node);
+        }
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            while (stream.peek() != EOF)
+        // Recreates the nodes from the binary format, the data is assumed to start with the binary header
+        class BinaryReader
+        {
+        public:
+            explicit BinaryReader(CharStringView data) :
+                m_data{data},
+                m_pos{binaryHeader.size()}
             {
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void readNode(DataIO::Node& node, unsigned int depth = 0)
+            {
+                if (depth > maxBinaryNodeDepth)
+                    throw Exception{U"Error while reading binary data, the nodes are nested too deeply."};
+
+                node.name = readString();
 
-                String word = readWord(stream);
-                if (word == U"")
+                const std::size_t propertyCount = readCount(minBinaryPropertySize);
+                for (std::size_t i = 0; i < propertyCount; ++i)
                 {
-                    if (stream.peek() == EOF)
-                        return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
-                    {
-                        node->children.push_back(std::move(sectionNode));
+                    String key = readString();
+                    auto valueNode = readValue();
 
-                        stream.read(&chr, 1);
+                    // The properties were written in sorted order, so they can be inserted at the end of the map
+                    node.propertyValuePairs.emplace_hint(node.propertyValuePairs.end(), std::move(key), std::move(valueNode));
+                }
 
-                        // Ignore semicolon behind closing brace
-                        REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                const std::size_t childCount = readCount(minBinaryNodeSize);
+                node.children.reserve(childCount);
+                for (std::size_t i = 0; i < childCount; ++i)
+                {
+                    auto child = std::make_unique<DataIO::Node>();
+                    child->parent = &node;
+                    readNode(*child, depth + 1);
+                    node.children.push_back(std::move(child));
+                }
+            }
 
-                        REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        return "";
-                    }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD std::unique_ptr<DataIO::ValueNode> readValue()
+            {
+                auto valueNode = std::make_unique<DataIO::ValueNode>();
+                const auto valueType = static_cast<BinaryValueType>(readByte());
+                if (valueType == BinaryValueType::Text)
+                {
+                    valueNode->value = readString();
+                    valueNode->listNode = (readByte() != 0);
+
+                    const std::size_t listSize = readCount(minBinaryStringSize);
+                    valueNode->valueList.reserve(listSize);
+                    for (std::size_t i = 0; i < listSize; ++i)
+                        valueNode->valueList.push_back(readString());
+
+                    return valueNode;
                 }
 
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                valueNode->typed = std::make_unique<DataIO::TypedValue>();
+                DataIO::TypedValue& typed = *valueNode->typed;
+                switch (valueType)
                 {
-                    String error = parseSection(stream, sectionNode, word);
-                    if (!error.empty())
-                        return error;
+                case BinaryValueType::Bool:
+                    typed.type = ObjectConverter::Type::Bool;
+                    typed.value = ObjectConverter{readByte() != 0};
+                    break;
+                case BinaryValueType::Number:
+                    typed.type = ObjectConverter::Type::Number;
+                    typed.value = ObjectConverter{readFloat()};
+                    break;
+                case BinaryValueType::Color:
+                {
+                    const bool isSet = (readByte() != 0);
+                    const std::uint8_t red = readByte();
+                    const std::uint8_t green = readByte();
+                    const std::uint8_t blue = readByte();
+                    const std::uint8_t alpha = readByte();
+
+                    typed.type = ObjectConverter::Type::Color;
+                    typed.value = isSet ? ObjectConverter{Color{red, green, blue, alpha}} : ObjectConverter{Color{}};
+                    break;
                 }
-                else if (stream.peek() == '=')
+                case BinaryValueType::Outline:
                 {
-                    String error = parseKeyValue(stream, sectionNode, word);
-                    if (!error.empty())
-                        return error;
+                    const float left = readFloat();
+                    const float top = readFloat();
+                    const float right = readFloat();
+                    const float bottom = readFloat();
+
+                    typed.type = ObjectConverter::Type::Outline;
+                    typed.value = ObjectConverter{Outline{left, top, right, bottom}};
+                    break;
                 }
-                else if (stream.peek() == ':')
+                case BinaryValueType::TextStyle:
+                    typed.type = ObjectConverter::Type::TextStyle;
+                    typed.value = ObjectConverter{TextStyles{static_cast<unsigned int>(readNumber())}};
+                    break;
+                case BinaryValueType::Texture:
                 {
-                    String error = parseInheritance(stream, sectionNode, word);
-                    if (!error.empty())
-                        return error;
+                    typed.type = ObjectConverter::Type::Texture;
+                    valueNode->value = readString();
+                    typed.texturePartRect = readRect();
+                    typed.textureMiddleRect = readRect();
+
+                    const std::uint8_t smooth = readByte();
+                    if (smooth <= 1)
+                        typed.textureSmooth.emplace(smooth != 0);
+                    break;
                 }
-                else
-                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                case BinaryValueType::Font:
+                    typed.type = ObjectConverter::Type::Font;
+                    valueNode->value = readString();
+                    break;
+                default:
+                    throw Exception{U"Error while reading binary data, the data is truncated or corrupt."};
+                }
+
+                return valueNode;
             }
 
-            return "Found EOF while reading section.";
-        }
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool atEnd() const
+            {
+                return m_pos == m_data.size();
+            }
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
-        {
-            REMOVE_WHITESPACE_AND_COMMENTS(false)
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
 
-            String word = readWord(stream);
-            if (word == U"")
+            void requireBytes(std::size_t count) const
             {
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (m_data.size() - m_pos < count)
+                    throw Exception{U"Error while reading binary data, the data is truncated or corrupt."};
             }
 
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
-            else if (stream.peek() == ':')
-                return parseInheritance(stream, root, word);
-            else
-                return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
-        }
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD std::uint8_t readByte()
+            {
+                requireBytes(1);
+                return static_cast<std::uint8_t>(m_data[m_pos++]);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD std::size_t readNumber()
+            {
+                requireBytes(4);
+                std::uint32_t number = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    number |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(m_data[m_pos++])) << (8 * i);
+
+                return number;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD float readFloat()
+            {
+                const auto bits = static_cast<std::uint32_t>(readNumber());
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD UIntRect readRect()
+            {
+                const auto left = static_cast<unsigned int>(readNumber());
+                const auto top = static_cast<unsigned int>(readNumber());
+                const auto width = static_cast<unsigned int>(readNumber());
+                const auto height = static_cast<unsigned int>(readNumber());
+                return {left, top, width, height};
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Reads the amount of elements that follow, while checking that the remaining data is large enough to contain them
+            TGUI_NODISCARD std::size_t readCount(std::size_t minElementSize)
+            {
+                const std::size_t count = readNumber();
+                if (count > (m_data.size() - m_pos) / minElementSize)
+                    throw Exception{U"Error while reading binary data, the data is truncated or corrupt."};
+
+                return count;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            TGUI_NODISCARD String readString()
+            {
+                const std::size_t length = readNumber();
+                requireBytes(length);
+
+                String str(m_data.data() + m_pos, length);
+                m_pos += length;
+                return str;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            CharStringView m_data;
+            std::size_t m_pos;
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -536,7 +944,7 @@ namespace tgui
             if (!node->propertyValuePairs.empty())
             {
                 for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                    output.emplace_back("    " + pair.first + " = " + DataIO::serializeValue(*pair.second) + ";");
             }
 
             if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
@@ -569,24 +977,39 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        const std::string str = stream.str();
+        const auto position = stream.tellg();
+        const std::size_t offset = (position != std::stringstream::pos_type(-1)) ? static_cast<std::size_t>(position) : 0;
+
+        auto root = parse(CharStringView{str.data() + offset, str.size() - offset});
+        stream.seekg(0, std::ios_base::end);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(CharStringView data)
     {
         auto root = std::make_unique<Node>();
+        if (isBinary(data))
+        {
+            BinaryReader reader{data};
+            reader.readNode(*root);
+            if (!reader.atEnd())
+                throw Exception{U"Error while reading binary data, unexpected data found behind the root node."};
+
+            return root;
+        }
 
-        String error;
-        while (stream.peek() != EOF)
+        Parser parser{data};
+        while (!parser.atEnd())
         {
-            error = parseRootSection(stream, root);
+            const String error = parser.parseRootSection(*root);
             if (!error.empty())
             {
-                const auto position = stream.tellg();
-                if (position != std::stringstream::pos_type(-1))
-                {
-                    String str = stream.str();
-                    auto lineNumber = std::count(str.begin(), str.begin() + static_cast<std::ptrdiff_t>(position), U'\n') + 1;
-                    throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
-                }
-                else
-                    throw Exception{U"Error while parsing input. " + error};
+                const auto lineNumber = std::count(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(parser.getPosition()), '\n') + 1;
+                throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
             }
         }
 
@@ -595,10 +1018,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        std::string output(binaryHeader.begin(), binaryHeader.end());
+        writeBinaryNode(output, *rootNode);
+        stream.write(output.data(), static_cast<std::streamsize>(output.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataIO::isBinary(CharStringView data)
+    {
+        return (data.size() >= binaryHeader.size()) && std::equal(binaryHeader.begin(), binaryHeader.end(), data.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value << ";" << std::endl;
+            stream << pair.first << " = " << serializeValue(*pair.second) << ";" << std::endl;
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
             stream << std::endl;
@@ -618,6 +1057,65 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String DataIO::serializeValue(const ValueNode& valueNode)
+    {
+        if (!valueNode.typed)
+            return valueNode.value;
+
+        const TypedValue& typed = *valueNode.typed;
+        switch (typed.type)
+        {
+        case ObjectConverter::Type::Texture:
+        {
+            String result = U"\"" + valueNode.value + U"\"";
+            const UIntRect& partRect = typed.texturePartRect;
+            if (partRect != UIntRect{})
+            {
+                result += U" Part(" + String::fromNumber(partRect.left) + U", " + String::fromNumber(partRect.top)
+                            + U", " + String::fromNumber(partRect.width) + U", " + String::fromNumber(partRect.height) + U")";
+            }
+
+            const UIntRect& middleRect = typed.textureMiddleRect;
+            if (middleRect != UIntRect{})
+            {
+                result += U" Middle(" + String::fromNumber(middleRect.left) + U", " + String::fromNumber(middleRect.top)
+                            + U", " + String::fromNumber(middleRect.width) + U", " + String::fromNumber(middleRect.height) + U")";
+            }
+
+            if (typed.textureSmooth)
+                result += *typed.textureSmooth ? U" Smooth" : U" NoSmooth";
+
+            return result;
+        }
+        case ObjectConverter::Type::Font:
+            return Serializer::serialize(ObjectConverter{valueNode.value});
+        default:
+            return Serializer::serialize(ObjectConverter{typed.value});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter DataIO::createObjectConverter(const ValueNode& valueNode)
+    {
+        if (!valueNode.typed)
+            return ObjectConverter{valueNode.value};
+
+        const TypedValue& typed = *valueNode.typed;
+        switch (typed.type)
+        {
+        case ObjectConverter::Type::Texture:
+            return Texture{valueNode.value, typed.texturePartRect, typed.textureMiddleRect,
+                           typed.textureSmooth ? *typed.textureSmooth : Texture::getDefaultSmooth()};
+        case ObjectConverter::Type::Font:
+            return Font{valueNode.value};
+        default:
+            return typed.value;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,96 +299,10 @@ namespace tgui
             String filename;
             UIntRect partRect;
             UIntRect middleRect;
-            bool smooth = Texture::getDefaultSmooth();
+            Optional<bool> smoothParam;
+            Deserializer::splitTexture(value, filename, partRect, middleRect, smoothParam);
 
-            // If there are no quotes then the value just contains a filename
-            if (value[0] != '"')
-                filename = value;
-            else
-            {
-                String::const_iterator c = value.begin();
-                ++c; // Skip the opening quote
-
-                // Look for the end quote
-                char32_t prev = U'\0';
-                bool filenameFound = false;
-                while (c != value.end())
-                {
-                    if ((*c != U'"') || (prev == U'\\'))
-                    {
-                        prev = *c;
-                        filename.push_back(*c);
-                        ++c;
-                    }
-                    else
-                    {
-                        ++c;
-                        filenameFound = true;
-                        break;
-                    }
-                }
-
-                if (!filenameFound)
-                    throw Exception{U"Failed to deserialize texture '" + value + U"'. Failed to find the closing quote of the filename."};
-
-                // There may be optional parameters
-                while (removeWhitespace(value, c))
-                {
-                    const auto startOffset = static_cast<std::size_t>(c - value.begin());
-
-                    String word;
-                    auto openingBracketPos = value.find(U'(', startOffset);
-                    if (openingBracketPos != String::npos)
-                        word = value.substr(startOffset, openingBracketPos - startOffset);
-                    else
-                    {
-                        const String& smoothParam = value.substr(startOffset).trim();
-                        if (viewEqualIgnoreCase(smoothParam, U"smooth"))
-                        {
-                            smooth = true;
-                            break;
-                        }
-                        else if (viewEqualIgnoreCase(smoothParam, U"nosmooth"))
-                        {
-                            smooth = false;
-                            break;
-                        }
-                        else
-                            throw Exception{U"Failed to deserialize texture '" + value + U"'. Invalid text found behind filename."};
-                    }
-
-                    if (word.empty())
-                        throw Exception{U"Failed to deserialize texture '" + value + U"'. Expected 'Part' or 'Middle' in front of opening bracket."};
-
-                    bool rectRequiresFourValues = true;
-                    UIntRect* rect = nullptr;
-                    if (viewEqualIgnoreCase(word, U"part"))
-                    {
-                        rect = &partRect;
-                        std::advance(c, 4);
-                    }
-                    else if (viewEqualIgnoreCase(word, U"middle"))
-                    {
-                        rectRequiresFourValues = false;
-                        rect = &middleRect;
-                        std::advance(c, 6);
-                    }
-                    else
-                        throw Exception{U"Failed to deserialize texture '" + value + U"'. Unexpected word '" + word + U"' in front of opening bracket. Expected 'Part' or 'Middle'."};
-
-                    const auto endOffset = static_cast<std::size_t>(c - value.begin());
-                    auto closeBracketPos = value.find(U')', endOffset);
-                    if (closeBracketPos != String::npos)
-                    {
-                        if (!readUIntRect(value.substr(endOffset, closeBracketPos - endOffset + 1), *rect, rectRequiresFourValues))
-                            throw Exception{U"Failed to parse " + word + U" rectangle while deserializing texture '" + value + U"'."};
-                    }
-                    else
-                        throw Exception{U"Failed to deserialize texture '" + value + U"'. Failed to find closing bracket for " + word + U" rectangle."};
-
-                    std::advance(c, static_cast<std::ptrdiff_t>(closeBracketPos - endOffset + 1));
-                }
-            }
+            const bool smooth = smoothParam ? *smoothParam : Texture::getDefaultSmooth();
 
             // Check if the texture is provided as a base64-encoded string
             if (filename.starts_with(U"data:"))
@@ -433,8 +347,7 @@ namespace tgui
 
         ObjectConverter deserializeRendererData(const String& renderer)
         {
-            std::stringstream ss{renderer.toStdString()};
-            auto node = DataIO::parse(ss);
+            auto node = DataIO::parse(renderer.toStdString());
 
             // The root node should contain exactly one child which is the node we need
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
@@ -496,6 +409,108 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Deserializer::splitTexture(const String& value, String& filename, UIntRect& partRect, UIntRect& middleRect, Optional<bool>& smooth)
+    {
+        filename.clear();
+        partRect = {};
+        middleRect = {};
+        smooth.reset();
+
+        if (value.empty() || viewEqualIgnoreCase(value, U"none"))
+            return;
+
+        // If there are no quotes then the value just contains a filename
+        if (value[0] != '"')
+            filename = value;
+        else
+        {
+            String::const_iterator c = value.begin();
+            ++c; // Skip the opening quote
+
+            // Look for the end quote
+            char32_t prev = U'\0';
+            bool filenameFound = false;
+            while (c != value.end())
+            {
+                if ((*c != U'"') || (prev == U'\\'))
+                {
+                    prev = *c;
+                    filename.push_back(*c);
+                    ++c;
+                }
+                else
+                {
+                    ++c;
+                    filenameFound = true;
+                    break;
+                }
+            }
+
+            if (!filenameFound)
+                throw Exception{U"Failed to deserialize texture '" + value + U"'. Failed to find the closing quote of the filename."};
+
+            // There may be optional parameters
+            while (removeWhitespace(value, c))
+            {
+                const auto startOffset = static_cast<std::size_t>(c - value.begin());
+
+                String word;
+                auto openingBracketPos = value.find(U'(', startOffset);
+                if (openingBracketPos != String::npos)
+                    word = value.substr(startOffset, openingBracketPos - startOffset);
+                else
+                {
+                    const String& smoothParam = value.substr(startOffset).trim();
+                    if (viewEqualIgnoreCase(smoothParam, U"smooth"))
+                    {
+                        smooth.emplace(true);
+                        break;
+                    }
+                    else if (viewEqualIgnoreCase(smoothParam, U"nosmooth"))
+                    {
+                        smooth.emplace(false);
+                        break;
+                    }
+                    else
+                        throw Exception{U"Failed to deserialize texture '" + value + U"'. Invalid text found behind filename."};
+                }
+
+                if (word.empty())
+                    throw Exception{U"Failed to deserialize texture '" + value + U"'. Expected 'Part' or 'Middle' in front of opening bracket."};
+
+                bool rectRequiresFourValues = true;
+                UIntRect* rect = nullptr;
+                if (viewEqualIgnoreCase(word, U"part"))
+                {
+                    rect = &partRect;
+                    std::advance(c, 4);
+                }
+                else if (viewEqualIgnoreCase(word, U"middle"))
+                {
+                    rectRequiresFourValues = false;
+                    rect = &middleRect;
+                    std::advance(c, 6);
+                }
+                else
+                    throw Exception{U"Failed to deserialize texture '" + value + U"'. Unexpected word '" + word + U"' in front of opening bracket. Expected 'Part' or 'Middle'."};
+
+                const auto endOffset = static_cast<std::size_t>(c - value.begin());
+                auto closeBracketPos = value.find(U')', endOffset);
+                if (closeBracketPos != String::npos)
+                {
+                    if (!readUIntRect(value.substr(endOffset, closeBracketPos - endOffset + 1), *rect, rectRequiresFourValues))
+                        throw Exception{U"Failed to parse " + word + U" rectangle while deserializing texture '" + value + U"'."};
+                }
+                else
+                    throw Exception{U"Failed to deserialize texture '" + value + U"'. Failed to find closing bracket for " + word + U" rectangle."};
+
+                std::advance(c, static_cast<std::ptrdiff_t>(closeBracketPos - endOffset + 1));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<String> Deserializer::split(const String& str, char delim)
     {
         std::vector<String> tokens;
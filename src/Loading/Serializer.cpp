@@ -209,7 +209,9 @@ namespace tgui
             if (texture.getData()->backendTexture)
             {
                 const UIntRect& partRect = texture.getPartRect();
-                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, texture.getData()->backendTexture->getSize()}))
+                const UIntRect& atlasRect = texture.getData()->atlasRect;
+                const Vector2u imageSize = (atlasRect != UIntRect{}) ? atlasRect.getSize() : texture.getData()->backendTexture->getSize();
+                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, imageSize}))
                 {
                     result += " Part(" + String::fromNumber(partRect.left) + ", " + String::fromNumber(partRect.top)
                                 + ", " + String::fromNumber(partRect.width) + ", " + String::fromNumber(partRect.height) + ")";
@@ -266,8 +268,7 @@ namespace tgui
                 String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
-                    node->children.push_back(DataIO::parse(ss));
+                    node->children.push_back(DataIO::parse(ObjectConverter{pair.second}.getString().toStdString()));
                     node->children.back()->name = pair.first;
                 }
                 else
@@ -649,14 +649,13 @@ namespace tgui
                 continue;
 
             auto& renderer = pair.second;
-            const auto& properties = m_themeLoader->load(m_primary, pair.first);
+            auto properties = m_themeLoader->loadValues(m_primary, pair.first);
             auto observers = std::move(renderer->observers);
 
             renderer = RendererData::create();
             renderer->observers = std::move(observers);
             renderer->connectedTheme = this;
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            renderer->propertyValuePairs = std::move(properties);
 
             for (auto& observer : renderer->observers)
                 observer->setRenderer(renderer);
@@ -696,11 +695,7 @@ namespace tgui
             if (rendererToCopyIt != otherTheme.m_renderers.end())
                 newRenderer->propertyValuePairs = rendererToCopyIt->second->propertyValuePairs;
             else
-            {
-                const auto& properties = m_themeLoader->load(m_primary, id);
-                for (const auto& property : properties)
-                    newRenderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-            }
+                newRenderer->propertyValuePairs = m_themeLoader->loadValues(m_primary, id);
 
             existingRenderer = newRenderer;
 
@@ -739,9 +734,7 @@ namespace tgui
 
         m_renderers[id] = RendererData::create();
         m_renderers[id]->connectedTheme = this;
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[id]->propertyValuePairs = m_themeLoader->loadValues(m_primary, id);
 
         return m_renderers[id];
     }
@@ -760,10 +753,7 @@ namespace tgui
 
         m_renderers[id] = RendererData::create();
         m_renderers[id]->connectedTheme = this;
-
-        const auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[id]->propertyValuePairs = m_themeLoader->loadValues(m_primary, id);
 
         return m_renderers[id];
     }
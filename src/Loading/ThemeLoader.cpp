@@ -25,6 +25,7 @@
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <sstream>
@@ -40,10 +41,102 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Properties that contain filenames, which get their path changed when the theme is loaded
+        TGUI_NODISCARD bool isFileProperty(const String& property)
+        {
+            return ((property.size() >= 7) && (property.substr(0, 7) == U"Texture")) || (property == U"Font") || (property == U"Image") || (property == U"Icon");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether a section contains values that were deserialized before they were stored in the binary format
+        TGUI_NODISCARD bool containsTypedValues(const DataIO::Node& node)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if (pair.second->typed)
+                    return true;
+            }
+
+            for (const auto& child : node.children)
+            {
+                if (containsTypedValues(*child))
+                    return true;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the properties of a section as text, nested sections are turned into text as well
+        TGUI_NODISCARD std::map<String, String> convertSectionToText(const DataIO::Node& node)
+        {
+            std::map<String, String> properties;
+            for (const auto& pair : node.propertyValuePairs)
+                properties[pair.first] = DataIO::serializeValue(*pair.second);
+
+            for (const auto& nestedProperty : node.children)
+            {
+                std::stringstream ss;
+                DataIO::emit(nestedProperty, ss);
+                properties[nestedProperty->name] = "{\n" + ss.str() + "}";
+            }
+
+            return properties;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Replaces references to sections by copies of those sections, which are added as nested sections. Unlike in
+        // BaseThemeLoader::resolveReferences, the copies aren't turned into text so that their values can still be deserialized.
+        void resolveReferencesToNodes(const std::map<String, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                      const std::map<String, String>& globalProperties,
+                                      const std::unique_ptr<DataIO::Node>& node)
+        {
+            auto it = node->propertyValuePairs.begin();
+            while (it != node->propertyValuePairs.end())
+            {
+                if (it->second->typed || it->second->value.empty() || (it->second->value[0] != '&'))
+                {
+                    ++it;
+                    continue;
+                }
+
+                const String name = Deserializer::deserialize(ObjectConverter::Type::String, it->second->value.substr(1)).getString();
+                const auto sectionsIt = sections.find(name);
+                if (sectionsIt == sections.end())
+                {
+                    const auto globalPropertyIt = globalProperties.find(name);
+                    if (globalPropertyIt == globalProperties.end())
+                        throw Exception{U"Undefined reference to '" + name + U"' encountered."};
+
+                    it->second->value = globalPropertyIt->second;
+                    ++it;
+                    continue;
+                }
+
+                resolveReferencesToNodes(sections, globalProperties, sectionsIt->second);
+
+                auto nestedSection = std::make_unique<DataIO::Node>(*sectionsIt->second.get());
+                nestedSection->parent = node.get();
+                nestedSection->name = it->first;
+                node->children.push_back(std::move(nestedSection));
+                it = node->propertyValuePairs.erase(it);
+            }
+
+            for (const auto& child : node->children)
+                resolveReferencesToNodes(sections, globalProperties, child);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<String, std::map<String, std::map<String, String>>> DefaultThemeLoader::m_propertiesCache;
     std::map<String, std::map<String, String>> DefaultThemeLoader::m_globalPropertiesCache;
+    std::map<String, std::map<String, std::unique_ptr<DataIO::Node>>> DefaultThemeLoader::m_sectionsCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,11 +153,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<String, ObjectConverter> BaseThemeLoader::loadValues(const String& primary, const String& secondary)
+    {
+        std::map<String, ObjectConverter> values;
+        for (const auto& property : load(primary, secondary))
+            values[property.first] = ObjectConverter(property.second);
+
+        return values;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BaseThemeLoader::injectThemePath(const std::unique_ptr<DataIO::Node>& node, const String& path) const
     {
         for (const auto& pair : node->propertyValuePairs)
         {
-            if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image") || (pair.first == U"Icon"))
+            if (isFileProperty(pair.first))
             {
                 if (pair.second->value.empty() || viewEqualIgnoreCase(pair.second->value, U"none") || viewEqualIgnoreCase(pair.second->value, U"null") || viewEqualIgnoreCase(pair.second->value, U"nullptr"))
                     continue;
@@ -114,7 +218,7 @@ namespace tgui
         for (const auto& pair : node->propertyValuePairs)
         {
             // Check if this property is a reference to another section
-            if (!pair.second->value.empty() && (pair.second->value[0] == '&'))
+            if (!pair.second->typed && !pair.second->value.empty() && (pair.second->value[0] == '&'))
             {
                 const String name = Deserializer::deserialize(ObjectConverter::Type::String, pair.second->value.substr(1)).getString();
                 const auto sectionsIt = sections.find(name);
@@ -154,11 +258,13 @@ namespace tgui
         {
             m_propertiesCache.erase(filename);
             m_globalPropertiesCache.erase(filename);
+            m_sectionsCache.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
             m_globalPropertiesCache.clear();
+            m_sectionsCache.clear();
         }
     }
 
@@ -170,7 +276,7 @@ namespace tgui
             return;
 
         // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        if (m_sectionsCache.find(filename) == m_sectionsCache.end())
         {
             std::unique_ptr<DataIO::Node> root = readFile(filename);
             if (!root)
@@ -180,34 +286,43 @@ namespace tgui
                 m_globalPropertiesCache[filename][pair.first] = pair.second->value;
 
             // Get a list of section names and map them to their nodes (needed for resolving references)
+            std::vector<String> sectionNames;
             std::map<String, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
             for (const auto& child : root->children)
             {
-                const String name = Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString();
-                sections.emplace(name, std::cref(child));
+                sectionNames.push_back(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
+                sections.emplace(sectionNames.back(), std::cref(child));
             }
 
             // Resolve references to sections
             resolveReferences(sections, m_globalPropertiesCache[filename], root);
 
             // Create empty sections for all widget types
+            auto& sectionsCache = m_sectionsCache[filename];
+            auto& propertiesCache = m_propertiesCache[filename];
             for (const auto& widgetType : WidgetFactory::getWidgetTypes())
-                m_propertiesCache[filename][widgetType] = {};
+            {
+                sectionsCache[widgetType] = std::make_unique<DataIO::Node>();
+                propertiesCache[widgetType] = {};
+            }
 
-            // Cache all propery value pairs
-            for (const auto& section : sections)
+            // Cache the nodes of all sections, from which Theme gets the values for its renderers
+            for (std::size_t i = 0; i < root->children.size(); ++i)
             {
-                const auto& child = section.second;
-                const String& name = section.first;
-                for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][pair.first] = pair.second->value;
+                // If multiple sections have the same name then only the first one is used
+                auto& child = root->children[i];
+                const String& name = sectionNames[i];
+                if (&sections.at(name).get() != &child)
+                    continue;
 
-                for (const auto& nestedProperty : child.get()->children)
-                {
-                    std::stringstream ss;
-                    DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][nestedProperty->name] = "{\n" + ss.str() + "}";
-                }
+                // Sections of compiled themes are only turned into text when the load function requests them
+                if (containsTypedValues(*child))
+                    propertiesCache.erase(name);
+                else
+                    propertiesCache[name] = convertSectionToText(*child);
+
+                child->parent = nullptr;
+                sectionsCache[name] = std::move(child);
             }
         }
     }
@@ -230,10 +345,36 @@ namespace tgui
         if (filename.empty())
             return m_propertiesCache[""][section];
 
-        if (m_propertiesCache[filename].find(section) == m_propertiesCache[filename].end())
+        const auto& sectionsCache = m_sectionsCache[filename];
+        const auto sectionIt = sectionsCache.find(section);
+        if (sectionIt == sectionsCache.end())
+            throw Exception{U"No section '" + section + U"' was found in file '" + filename + "'."};
+
+        auto& propertiesCache = m_propertiesCache[filename];
+        auto propertiesIt = propertiesCache.find(section);
+        if (propertiesIt == propertiesCache.end())
+            propertiesIt = propertiesCache.emplace(section, convertSectionToText(*sectionIt->second)).first;
+
+        return propertiesIt->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<String, ObjectConverter> DefaultThemeLoader::loadValues(const String& filename, const String& section)
+    {
+        preload(filename);
+
+        if (filename.empty())
+            return {};
+
+        const auto& sectionsCache = m_sectionsCache[filename];
+        const auto sectionIt = sectionsCache.find(section);
+        if (sectionIt == sectionsCache.end())
             throw Exception{U"No section '" + section + U"' was found in file '" + filename + "'."};
 
-        return m_propertiesCache[filename][section];
+        // Values that were stored in the binary format are used directly, text values are deserialized when they are used
+        auto rendererData = RendererData::createFromDataIONode(sectionIt->second.get());
+        return std::move(rendererData->propertyValuePairs);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,16 +384,45 @@ namespace tgui
         if (filename.empty())
             return true;
         else
-            return m_propertiesCache[filename].find(section) != m_propertiesCache[filename].end();
+            return m_sectionsCache[filename].find(section) != m_sectionsCache[filename].end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::unique_ptr<DataIO::Node> DefaultThemeLoader::readFile(const String& filename) const
+    void DefaultThemeLoader::compileToBinary(const String& filename, std::stringstream& stream)
     {
         if (filename.empty())
-            return nullptr;
+            throw Exception{U"DefaultThemeLoader::compileToBinary called with empty filename."};
+
+        std::unique_ptr<DataIO::Node> root = readFileWithoutPath(filename);
+
+        std::map<String, String> globalProperties;
+        for (const auto& pair : root->propertyValuePairs)
+            globalProperties[pair.first] = pair.second->value;
+
+        std::map<String, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+        for (const auto& child : root->children)
+        {
+            const String name = Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString();
+            sections.emplace(name, std::cref(child));
+        }
+
+        // Copy the referenced sections into the sections that refer to them and deserialize the values of all sections,
+        // so that loading the compiled theme doesn't have to resolve references or deserialize text.
+        // The paths of textures and fonts are still inserted when the theme is loaded, as they depend on its location.
+        for (const auto& child : root->children)
+            resolveReferencesToNodes(sections, globalProperties, child);
+
+        for (const auto& child : root->children)
+            RendererData::deserializeDataIONodeValues(*child);
+
+        DataIO::emitBinary(root, stream);
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DefaultThemeLoader::readFileWithoutPath(const String& filename)
+    {
         String fullFilename;
 #ifdef TGUI_SYSTEM_WINDOWS
         if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
@@ -268,10 +438,18 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), static_cast<std::streamsize>(fileSize));
+        // The file may either contain the text format or the binary format created by compileToBinary
+        return DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DefaultThemeLoader::readFile(const String& filename) const
+    {
+        if (filename.empty())
+            return nullptr;
 
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> root = readFileWithoutPath(filename);
 
         String resourcePath;
         auto slashPos = filename.find_last_of("/\\");
@@ -31,6 +31,8 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_TYPE(BoxLayoutRenderer, SpaceBetweenWidgets, Number)
+
     void BoxLayoutRenderer::setSpaceBetweenWidgets(float distance)
     {
         setProperty("SpaceBetweenWidgets", ObjectConverter{distance});
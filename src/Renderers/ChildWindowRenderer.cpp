@@ -53,6 +53,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_TYPE(ChildWindowRenderer, TitleBarHeight, Number)
+
     float ChildWindowRenderer::getTitleBarHeight() const
     {
         auto it = m_data->propertyValuePairs.find("TitleBarHeight");
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
 
@@ -30,6 +31,69 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Types of the renderer properties, filled by the TGUI_RENDERER_PROPERTY_* macros during static initialization
+        TGUI_NODISCARD std::map<String, ObjectConverter::Type>& getPropertyTypes()
+        {
+            static std::map<String, ObjectConverter::Type> propertyTypes;
+            return propertyTypes;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Deserializes the value while keeping textures and fonts as filenames. Returns nullptr if the value has to remain text.
+        TGUI_NODISCARD std::unique_ptr<DataIO::TypedValue> deserializeValue(const String& text, ObjectConverter::Type type, String& filename)
+        {
+            auto typed = std::make_unique<DataIO::TypedValue>();
+            typed->type = type;
+            if (type == ObjectConverter::Type::Texture)
+            {
+                Deserializer::splitTexture(text, filename, typed->texturePartRect, typed->textureMiddleRect, typed->textureSmooth);
+
+                // Textures without a filename or with embedded data are still deserialized from their text when loading them
+                if (filename.empty() || filename.starts_with(U"data:"))
+                    return nullptr;
+            }
+            else if (type == ObjectConverter::Type::Font)
+            {
+                if (viewEqualIgnoreCase(text, U"null") || viewEqualIgnoreCase(text, U"nullptr"))
+                    return nullptr;
+
+                filename = Deserializer::deserialize(ObjectConverter::Type::String, text).getString();
+                if (filename.empty())
+                    return nullptr;
+            }
+            else
+            {
+                typed->value = Deserializer::deserialize(type, text);
+
+                // The binary format can't store outlines that are relative to the size of the widget
+                if ((type == ObjectConverter::Type::Outline) && typed->value.getOutline().toString().contains(U'%'))
+                    return nullptr;
+            }
+
+            return typed;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addDataIONodeProperties(RendererData& rendererData, const DataIO::Node& rendererNode)
+        {
+            for (const auto& pair : rendererNode.propertyValuePairs)
+                rendererData.propertyValuePairs[pair.first] = DataIO::createObjectConverter(*pair.second);
+
+            // Nested sections are renderers of subwidgets
+            for (const auto& nestedProperty : rendererNode.children)
+            {
+                auto nestedRendererData = RendererData::create();
+                addDataIONodeProperties(*nestedRendererData, *nestedProperty);
+                rendererData.propertyValuePairs[nestedProperty->name] = ObjectConverter{nestedRendererData};
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     RendererData::RendererData(const RendererData& other) :
@@ -74,18 +138,66 @@ namespace tgui
     {
         auto rendererData = std::make_shared<RendererData>();
         rendererData->shared = false;
+        addDataIONodeProperties(*rendererData, *rendererNode);
+        return rendererData;
+    }
 
-        for (const auto& pair : rendererNode->propertyValuePairs)
-            rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        for (const auto& nestedProperty : rendererNode->children)
+    void RendererData::deserializeDataIONodeValues(DataIO::Node& rendererNode)
+    {
+        for (auto& pair : rendererNode.propertyValuePairs)
         {
-            std::stringstream ss;
-            DataIO::emit(nestedProperty, ss);
-            rendererData->propertyValuePairs[nestedProperty->name] = {String("{\n" + ss.str() + "}")};
+            DataIO::ValueNode& valueNode = *pair.second;
+            if (valueNode.typed || valueNode.listNode)
+                continue;
+
+            const ObjectConverter::Type type = getPropertyType(pair.first);
+            if (type == ObjectConverter::Type::None)
+                continue;
+
+            try
+            {
+                String filename;
+                valueNode.typed = deserializeValue(valueNode.value, type, filename);
+                if (!valueNode.typed)
+                    continue;
+
+                // Textures and fonts only store their filename, other types don't need their text anymore
+                valueNode.value = filename;
+            }
+            catch (const Exception&)
+            {
+                // Invalid values are kept as text, the error will be reported when the renderer tries to use the value
+            }
         }
 
-        return rendererData;
+        for (auto& nestedProperty : rendererNode.children)
+            deserializeDataIONodeValues(*nestedProperty);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RendererData::registerPropertyType(const char* property, ObjectConverter::Type type)
+    {
+        auto& propertyTypes = getPropertyTypes();
+        const auto result = propertyTypes.emplace(property, type);
+        if (!result.second && (result.first->second != type))
+            result.first->second = ObjectConverter::Type::None;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::Type RendererData::getPropertyType(const String& property)
+    {
+        const auto& propertyTypes = getPropertyTypes();
+        const auto it = propertyTypes.find(property);
+        if (it != propertyTypes.end())
+            return it->second;
+        else
+            return ObjectConverter::Type::None;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +254,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_TYPE(WidgetRenderer, Font, Font)
+
     void WidgetRenderer::setFont(const Font& font)
     {
         setProperty("Font", font);
@@ -160,6 +274,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_RENDERER_PROPERTY_TYPE(WidgetRenderer, TextSize, Number)
+
     void WidgetRenderer::setTextSize(unsigned int size)
     {
         setProperty("TextSize", static_cast<float>(size));
@@ -29,6 +29,8 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <mutex>
     #include <set>
 #endif
 
@@ -36,6 +38,69 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Allows searching the names without creating a std::string for the name that is searched
+        struct SignalNameLess
+        {
+            using is_transparent = void;
+
+            TGUI_NODISCARD bool operator()(const std::string& left, const std::string& right) const
+            {
+                return left < right;
+            }
+
+            TGUI_NODISCARD bool operator()(const std::string& left, CharStringView right) const
+            {
+                return CharStringView{left.data(), left.size()} < right;
+            }
+
+            TGUI_NODISCARD bool operator()(CharStringView left, const std::string& right) const
+            {
+                return left < CharStringView{right.data(), right.size()};
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns a pointer to a copy of the name that remains valid until the program ends. Each distinct name is only stored
+        // once, so signals with the same name share the copy. A set is used because its nodes don't move when names are added.
+        // This is only used for names that aren't string literals, signals that are members of widgets never get here.
+        TGUI_NODISCARD const char* storeSignalName(CharStringView name)
+        {
+            static std::mutex mutex;
+            static std::set<std::string, SignalNameLess> names;
+
+            const std::lock_guard<std::mutex> lock(mutex);
+            auto it = names.find(name);
+            if (it == names.end())
+                it = names.emplace(name.data(), name.size()).first;
+
+            return it->c_str();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Handlers are only removed from the list when no emit call is iterating over them. A handler that gets disconnected
+    // while the signal is being emitted is only marked as disconnected, as it might be the function that is being executed.
+    // Handlers that are connected during an emit call are kept separately until the emit finishes, because adding them to
+    // the list could move the functions that are being executed.
+    struct Signal::HandlerList
+    {
+        struct Handler
+        {
+            unsigned int id;
+            bool connected;
+            std::function<void()> func;
+        };
+
+        std::vector<Handler> handlers;
+        std::vector<Handler> pendingHandlers;
+        unsigned int emitDepth = 0;
+        bool containsDisconnectedHandlers = false;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::m_lastSignalId = 0;
@@ -43,6 +108,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Signal::Signal(String&& name, std::size_t extraParameters)
+    {
+        const std::string utf8Name = name.toStdString();
+        m_name = storeSignalName(CharStringView{utf8Name.data(), utf8Name.size()});
+
+        if (1 + extraParameters > m_parameters.size())
+            m_parameters.resize(1 + extraParameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal::Signal(const Signal& other) :
         m_enabled {other.m_enabled},
         m_name    {other.m_name},
@@ -58,7 +134,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -68,30 +144,147 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers)
+            return false;
+
+        auto& handlers = m_handlers->handlers;
+        const auto it = std::find_if(handlers.begin(), handlers.end(), [id](const HandlerList::Handler& handler){ return handler.id == id; });
+        if ((it != handlers.end()) && it->connected)
+        {
+            if (m_handlers->emitDepth > 0)
+            {
+                it->connected = false;
+                m_handlers->containsDisconnectedHandlers = true;
+            }
+            else
+            {
+                handlers.erase(it);
+                releaseEmptyHandlerList();
+            }
+
+            return true;
+        }
+
+        auto& pendingHandlers = m_handlers->pendingHandlers;
+        const auto pendingIt = std::find_if(pendingHandlers.begin(), pendingHandlers.end(), [id](const HandlerList::Handler& handler){ return handler.id == id; });
+        if (pendingIt != pendingHandlers.end())
+        {
+            pendingHandlers.erase(pendingIt);
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (!m_handlers)
+            return;
+
+        if (m_handlers->emitDepth > 0)
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.connected = false;
+
+            m_handlers->containsDisconnectedHandlers = true;
+            m_handlers->pendingHandlers.clear();
+        }
+        else
+            m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!m_enabled || !hasHandlers())
+            return false;
+
+        // The list may have become empty because handlers were disconnected while the signal was being emitted
+        if (releaseEmptyHandlerList())
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
-            handler.second();
+        // Keep the handlers alive in case the widget (and this signal) gets destroyed during the handler.
+        // The handlers that get connected during this call aren't executed until the next time the signal is emitted.
+        const std::shared_ptr<HandlerList> handlerList = m_handlers;
+        const std::size_t handlerCount = handlerList->handlers.size();
+
+        struct EmitScope
+        {
+            explicit EmitScope(HandlerList& list) : m_list(list) { ++m_list.emitDepth; }
+            EmitScope(const EmitScope&) = delete;
+            EmitScope& operator=(const EmitScope&) = delete;
+            ~EmitScope()
+            {
+                if (--m_list.emitDepth > 0)
+                    return;
+
+                if (m_list.containsDisconnectedHandlers)
+                {
+                    m_list.handlers.erase(std::remove_if(m_list.handlers.begin(), m_list.handlers.end(),
+                                                         [](const HandlerList::Handler& handler){ return !handler.connected; }),
+                                          m_list.handlers.end());
+                    m_list.containsDisconnectedHandlers = false;
+                }
+
+                if (!m_list.pendingHandlers.empty())
+                {
+                    for (auto& handler : m_list.pendingHandlers)
+                        m_list.handlers.push_back(std::move(handler));
+
+                    m_list.pendingHandlers.clear();
+                }
+            }
+
+            HandlerList& m_list;
+        };
+
+        bool handlerCalled = false;
+        {
+            const EmitScope scope{*handlerList};
+            for (std::size_t i = 0; i < handlerCount; ++i)
+            {
+                // The handler is accessed by index as the vector can't be reallocated while emitting, but it is still possible
+                // that a handler disconnects other handlers.
+                if (!handlerList->handlers[i].connected)
+                    continue;
+
+                handlerList->handlers[i].func();
+                handlerCalled = true;
+            }
+        }
+
+        return handlerCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::addHandler(std::function<void()>&& handler)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+
+        const auto id = ++m_lastSignalId;
+        if (m_handlers->emitDepth > 0)
+            m_handlers->pendingHandlers.push_back({id, true, std::move(handler)});
+        else
+            m_handlers->handlers.push_back({id, true, std::move(handler)});
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::releaseEmptyHandlerList()
+    {
+        if ((m_handlers->emitDepth > 0) || !m_handlers->handlers.empty() || !m_handlers->pendingHandlers.empty())
+            return false;
 
+        m_handlers = nullptr;
         return true;
     }
 
@@ -106,7 +299,7 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&childWindow);
@@ -124,7 +317,7 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -137,7 +330,7 @@ namespace tgui
 
     bool SignalPanelListBoxItem::emit(const Widget* widget, int index, const std::shared_ptr<Panel>& panel, const String& id)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -157,7 +350,7 @@ namespace tgui
 
     bool SignalFileDialogPaths::emit(const Widget* widget, const std::vector<Filesystem::Path>& paths)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         assert(!paths.empty());
@@ -172,7 +365,7 @@ namespace tgui
 
     bool SignalShowEffect::emit(const Widget* widget, ShowEffectType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -184,7 +377,7 @@ namespace tgui
 
     bool SignalAnimationType::emit(const Widget* widget, AnimationType type)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -195,7 +388,7 @@ namespace tgui
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         m_parameters[1] = static_cast<const void*>(&item);
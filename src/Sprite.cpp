@@ -46,6 +46,7 @@ namespace tgui
         m_size       (other.m_size),
         m_texture    (other.m_texture),
         m_svgTexture (nullptr),
+        m_pendingSvgTexture(nullptr),
         m_vertices   (other.m_vertices),
         m_indices    (other.m_indices),
         m_visibleRect(other.m_visibleRect),
@@ -65,6 +66,7 @@ namespace tgui
         m_size       (std::move(other.m_size)),
         m_texture    (std::move(other.m_texture)),
         m_svgTexture (std::move(other.m_svgTexture)),
+        m_pendingSvgTexture(std::move(other.m_pendingSvgTexture)),
         m_vertices   (std::move(other.m_vertices)),
         m_indices    (std::move(other.m_indices)),
         m_visibleRect(std::move(other.m_visibleRect)),
@@ -107,6 +109,7 @@ namespace tgui
             std::swap(m_size,        temp.m_size);
             std::swap(m_texture,     temp.m_texture);
             std::swap(m_svgTexture,  temp.m_svgTexture);
+            std::swap(m_pendingSvgTexture, temp.m_pendingSvgTexture);
             std::swap(m_vertices,    temp.m_vertices);
             std::swap(m_indices,     temp.m_indices);
             std::swap(m_visibleRect, temp.m_visibleRect);
@@ -132,6 +135,7 @@ namespace tgui
             m_size        = std::move(other.m_size);
             m_texture     = std::move(other.m_texture);
             m_svgTexture  = std::move(other.m_svgTexture);
+            m_pendingSvgTexture = std::move(other.m_pendingSvgTexture);
             m_vertices    = std::move(other.m_vertices);
             m_indices     = std::move(other.m_indices);
             m_visibleRect = std::move(other.m_visibleRect);
@@ -383,6 +387,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Sprite::updatePendingSvgTexture()
+    {
+        if (!m_pendingSvgTexture)
+            return false;
+
+        if (!m_texture.getData() || !m_texture.getData()->svgImage)
+        {
+            m_pendingSvgTexture = nullptr;
+            return false;
+        }
+
+        if (!m_texture.getData()->svgImage->isTextureReady(m_pendingSvgTexture))
+            return false;
+
+        m_svgTexture = std::move(m_pendingSvgTexture);
+        m_pendingSvgTexture = nullptr;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::updateVertices()
     {
         // Figure out how the image is scaled best
@@ -391,26 +416,32 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
+            TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
             if (!m_svgTexture)
-            {
-                m_svgTexture = getBackend()->createTexture();
-
-                TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
                 getBackend()->registerSvgSprite(this);
-            }
 
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // Sprites that show the same image at the same size share the rasterized texture.
+            // If the texture is still being rasterized in the background then we keep drawing the old one, stretched to the new size.
+            auto& svgImage = *m_texture.getData()->svgImage;
+            auto svgTexture = svgImage.getTexture(svgTextureSize);
+            if (m_svgTexture && (svgTexture != m_svgTexture) && !svgImage.isTextureReady(svgTexture))
+                m_pendingSvgTexture = std::move(svgTexture);
+            else
+            {
+                m_svgTexture = std::move(svgTexture);
+                m_pendingSvgTexture = nullptr;
+            }
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
         }
         else
         {
-            texCoordOffset = m_texture.getPartRect().getPosition();
+            texCoordOffset = m_texture.getPartRect().getPosition() + m_texture.getData()->atlasRect.getPosition();
             textureSize = Vector2f{m_texture.getPartRect().getSize()};
             middleRect = FloatRect{m_texture.getMiddleRect()};
             if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
@@ -584,8 +615,8 @@ namespace tgui
         {
             for (auto& vertex : m_vertices)
             {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
+                vertex.texCoords.x += static_cast<float>(texCoordOffset.x);
+                vertex.texCoords.y += static_cast<float>(texCoordOffset.y);
             }
         }
 
@@ -31,6 +31,14 @@
     #include <TGUI/extlibs/IncludeNanoSVG.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <system_error>
+    #include <cstdint>
+    #include <future>
+    #include <chrono>
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -39,11 +47,144 @@ namespace tgui
     {
         struct SvgImageData
         {
+            SvgImageData() = default;
+            SvgImageData(const SvgImageData&) = delete;
+            SvgImageData& operator=(const SvgImageData&) = delete;
+            ~SvgImageData();
+
+            struct CachedTexture
+            {
+                Vector2u size;
+                std::shared_ptr<BackendTexture> texture;
+                std::uint64_t lastUse = 0;
+                std::future<std::unique_ptr<std::uint8_t[]>> pendingPixels; // Only valid while rasterizing in the background
+            };
+
             NSVGimage* svg = nullptr;
             NSVGrasterizer* rasterizer = nullptr;
+
+            // Rasterized textures, shared by all sprites that display this image at the same size
+            std::vector<CachedTexture> cachedTextures;
+
+            // All images with cached textures form a linked list, so that the least recently used texture can be found
+            SvgImageData* prevImageWithCache = nullptr;
+            SvgImageData* nextImageWithCache = nullptr;
         };
     }
 
+    namespace
+    {
+        // These variables are trivially destructible, so svg images that are still alive during program exit can safely use them
+        priv::SvgImageData* firstImageWithCache = nullptr;
+        std::size_t textureCacheMemoryUsage = 0;
+        std::size_t textureCacheBudget = 32 * 1024 * 1024;
+        std::uint64_t textureCacheUseCounter = 0;
+        std::size_t pendingRasterizationCount = 0;
+        bool asyncRasterizationEnabled = false;
+
+        TGUI_NODISCARD std::size_t getTextureMemorySize(Vector2u size)
+        {
+            return static_cast<std::size_t>(size.x) * size.y * 4;
+        }
+
+        // The svg is only read while rasterizing, so multiple threads can rasterize it at once as long as they use their own rasterizer
+        TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> rasterizeSvgPixels(priv::NSVGrasterizer* rasterizer, priv::NSVGimage* svg, Vector2u size)
+        {
+            const float scaleX = size.x / static_cast<float>(svg->width);
+            const float scaleY = size.y / static_cast<float>(svg->height);
+
+            auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
+            nsvgRasterizeXY(rasterizer, svg, 0, 0, scaleX, scaleY,
+                            pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+            return pixels;
+        }
+
+        void rasterizeSvg(priv::SvgImageData& data, BackendTexture& texture, Vector2u size)
+        {
+            if (!data.rasterizer)
+                data.rasterizer = nsvgCreateRasterizer();
+
+            texture.load(size, rasterizeSvgPixels(data.rasterizer, data.svg, size), true);
+        }
+
+        // Updates the global counters when a texture is removed from the cache.
+        // If the texture was still being rasterized then this blocks until the worker thread is done.
+        void releaseCachedTexture(priv::SvgImageData::CachedTexture& cachedTexture)
+        {
+            textureCacheMemoryUsage -= getTextureMemorySize(cachedTexture.size);
+            if (cachedTexture.pendingPixels.valid())
+            {
+                cachedTexture.pendingPixels.wait();
+                --pendingRasterizationCount;
+            }
+        }
+
+        void removeImageFromCacheList(priv::SvgImageData& data)
+        {
+            if (data.prevImageWithCache)
+                data.prevImageWithCache->nextImageWithCache = data.nextImageWithCache;
+            else if (firstImageWithCache == &data)
+                firstImageWithCache = data.nextImageWithCache;
+
+            if (data.nextImageWithCache)
+                data.nextImageWithCache->prevImageWithCache = data.prevImageWithCache;
+
+            data.prevImageWithCache = nullptr;
+            data.nextImageWithCache = nullptr;
+        }
+
+        // Removes the least recently used textures that are only referenced by the cache until the memory fits in the budget
+        void evictUnusedSvgTextures()
+        {
+            while (textureCacheMemoryUsage > textureCacheBudget)
+            {
+                priv::SvgImageData* oldestImage = nullptr;
+                std::size_t oldestIndex = 0;
+                for (auto* image = firstImageWithCache; image; image = image->nextImageWithCache)
+                {
+                    for (std::size_t i = 0; i < image->cachedTextures.size(); ++i)
+                    {
+                        const auto& cachedTexture = image->cachedTextures[i];
+                        if (cachedTexture.texture.use_count() > 1)
+                            continue;
+
+                        if (!oldestImage || (cachedTexture.lastUse < oldestImage->cachedTextures[oldestIndex].lastUse))
+                        {
+                            oldestImage = image;
+                            oldestIndex = i;
+                        }
+                    }
+                }
+
+                // Stop when all remaining textures are still in use
+                if (!oldestImage)
+                    break;
+
+                releaseCachedTexture(oldestImage->cachedTextures[oldestIndex]);
+                oldestImage->cachedTextures.erase(oldestImage->cachedTextures.begin() + static_cast<std::ptrdiff_t>(oldestIndex));
+                if (oldestImage->cachedTextures.empty())
+                    removeImageFromCacheList(*oldestImage);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::SvgImageData::~SvgImageData()
+    {
+        // The textures have to be released before the svg is deleted, as worker threads may still be rasterizing it
+        for (auto& cachedTexture : cachedTextures)
+            releaseCachedTexture(cachedTexture);
+
+        cachedTextures.clear();
+        removeImageFromCacheList(*this);
+
+        if (rasterizer)
+            nsvgDeleteRasterizer(rasterizer);
+        if (svg)
+            nsvgDelete(svg);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage() :
@@ -65,13 +206,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SvgImage::~SvgImage()
-    {
-        if (m_data->rasterizer)
-            nsvgDeleteRasterizer(m_data->rasterizer);
-        if (m_data->svg)
-            nsvgDelete(m_data->svg);
-    }
+    SvgImage::~SvgImage() = default;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -97,21 +232,161 @@ namespace tgui
         if (!m_data->svg)
             return;
 
-        if (!m_data->rasterizer)
-            m_data->rasterizer = nsvgCreateRasterizer();
+        const float fontScale = getBackend()->getFontScale();
+        size.x = static_cast<unsigned int>(size.x * fontScale);
+        size.y = static_cast<unsigned int>(size.y * fontScale);
+
+        rasterizeSvg(*m_data, texture, size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> SvgImage::getTexture(Vector2u size)
+    {
+        if (!m_data->svg)
+            return getBackend()->createTexture();
 
         const float fontScale = getBackend()->getFontScale();
         size.x = static_cast<unsigned int>(size.x * fontScale);
         size.y = static_cast<unsigned int>(size.y * fontScale);
 
-        const float scaleX = size.x / static_cast<float>(m_data->svg->width);
-        const float scaleY = size.y / static_cast<float>(m_data->svg->height);
+        for (auto& cachedTexture : m_data->cachedTextures)
+        {
+            if (cachedTexture.size == size)
+            {
+                cachedTexture.lastUse = ++textureCacheUseCounter;
+                return cachedTexture.texture;
+            }
+        }
+
+        auto texture = getBackend()->createTexture();
+        priv::SvgImageData::CachedTexture cachedTexture;
+        cachedTexture.size = size;
+        cachedTexture.texture = texture;
+        cachedTexture.lastUse = ++textureCacheUseCounter;
 
-        auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeXY(m_data->rasterizer, m_data->svg, 0, 0, scaleX, scaleY,
-                        pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+        bool rasterizingInBackground = false;
+        if (asyncRasterizationEnabled && (size.x > 0) && (size.y > 0))
+        {
+            priv::NSVGimage* const svg = m_data->svg;
+            try
+            {
+                cachedTexture.pendingPixels = std::async(std::launch::async, [svg,size]{
+                    priv::NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+                    auto pixels = rasterizeSvgPixels(rasterizer, svg, size);
+                    nsvgDeleteRasterizer(rasterizer);
+                    return pixels;
+                });
+
+                rasterizingInBackground = true;
+                ++pendingRasterizationCount;
+            }
+            catch (const std::system_error&)
+            {
+                // We couldn't create a thread, so rasterize on this thread instead
+            }
+        }
+
+        if (!rasterizingInBackground)
+            rasterizeSvg(*m_data, *texture, size);
+
+        if (m_data->cachedTextures.empty())
+        {
+            m_data->nextImageWithCache = firstImageWithCache;
+            if (firstImageWithCache)
+                firstImageWithCache->prevImageWithCache = m_data.get();
+            firstImageWithCache = m_data.get();
+        }
+
+        m_data->cachedTextures.push_back(std::move(cachedTexture));
+        textureCacheMemoryUsage += getTextureMemorySize(size);
+
+        // The new texture is still referenced by the caller, so it can't be evicted immediately
+        evictUnusedSvgTextures();
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::isTextureReady(const std::shared_ptr<BackendTexture>& texture) const
+    {
+        for (const auto& cachedTexture : m_data->cachedTextures)
+        {
+            if (cachedTexture.texture == texture)
+                return !cachedTexture.pendingPixels.valid();
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setTextureCacheBudget(std::size_t bytes)
+    {
+        textureCacheBudget = bytes;
+        evictUnusedSvgTextures();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getTextureCacheBudget()
+    {
+        return textureCacheBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getTextureCacheMemoryUsage()
+    {
+        return textureCacheMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setAsyncRasterizationEnabled(bool enabled)
+    {
+        asyncRasterizationEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::isAsyncRasterizationEnabled()
+    {
+        return asyncRasterizationEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getPendingRasterizationCount()
+    {
+        return pendingRasterizationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::uploadFinishedRasterizations(bool waitForPending)
+    {
+        if (pendingRasterizationCount == 0)
+            return false;
+
+        bool textureUpdated = false;
+        for (auto* image = firstImageWithCache; image; image = image->nextImageWithCache)
+        {
+            for (auto& cachedTexture : image->cachedTextures)
+            {
+                if (!cachedTexture.pendingPixels.valid())
+                    continue;
+
+                if (!waitForPending && (cachedTexture.pendingPixels.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+                    continue;
+
+                cachedTexture.texture->load(cachedTexture.size, cachedTexture.pendingPixels.get(), true);
+                --pendingRasterizationCount;
+                textureUpdated = true;
+            }
+        }
 
-        texture.load(size, std::move(pixels), true);
+        return textureUpdated;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
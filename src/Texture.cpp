@@ -230,6 +230,7 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
     {
         auto data = std::make_shared<TextureData>();
         data->backendTexture = getBackend()->createTexture();
+        data->backendTexture->setPixelRetention(BackendTexture::PixelRetention::Full); // The image has no filename, the serializer needs the pixels
 
         Vector2u imageSize;
         auto pixelPtr = ImageLoader::loadFromMemory(fileData, fileDataSize, imageSize);
@@ -249,6 +250,7 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
     {
         auto data = std::make_shared<TextureData>();
         data->backendTexture = getBackend()->createTexture();
+        data->backendTexture->setPixelRetention(BackendTexture::PixelRetention::Full); // The image has no filename, the serializer needs the pixels
 
         auto pixelPtr = MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
         std::memcpy(pixelPtr.get(), pixels, size.x * size.y * 4);
@@ -379,7 +381,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + m_data->atlasRect.left,
+                                                           pixel.y + partRect.top + m_data->atlasRect.top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -477,6 +480,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         {
             if (m_data->svgImage)
                 m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
+            else if (m_data->atlasRect != UIntRect{})
+                m_partRect = {0, 0, m_data->atlasRect.width, m_data->atlasRect.height};
             else
             {
                 const Vector2u textureSize = m_data->backendTexture->getSize();
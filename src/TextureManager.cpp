@@ -27,12 +27,191 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
+    #include <array>
+    #include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
 
+    namespace
+    {
+        // Images on an atlas page are placed next to each other in horizontal rows
+        struct AtlasShelf
+        {
+            unsigned int top = 0;
+            unsigned int height = 0;
+            unsigned int usedWidth = 0;
+        };
+
+        struct AtlasPage
+        {
+            std::shared_ptr<BackendTexture> texture;
+            std::vector<AtlasShelf> shelves;
+            std::vector<UIntRect> freedSlots;
+            unsigned int imageCount = 0;
+        };
+
+        // Each image is surrounded by a border that repeats its edge pixels, so that smoothing doesn't blend neighbouring images
+        constexpr unsigned int atlasPadding = 1;
+
+        std::vector<AtlasPage> atlasPages;
+        bool atlasEnabled = false;
+        unsigned int atlasMaxImageSize = 256;
+        unsigned int atlasPageSize = 1024;
+
+        TGUI_NODISCARD bool allocateAtlasSlot(AtlasPage& page, Vector2u slotSize, UIntRect& slot)
+        {
+            // Reuse the space of a removed image if possible
+            for (auto it = page.freedSlots.begin(); it != page.freedSlots.end(); ++it)
+            {
+                if ((it->width >= slotSize.x) && (it->height >= slotSize.y))
+                {
+                    slot = {it->left, it->top, slotSize.x, slotSize.y};
+                    page.freedSlots.erase(it);
+                    return true;
+                }
+            }
+
+            // Place the image on the lowest shelf that still has room for it
+            const Vector2u pageSize = page.texture->getSize();
+            AtlasShelf* bestShelf = nullptr;
+            for (auto& shelf : page.shelves)
+            {
+                if ((shelf.height >= slotSize.y) && (shelf.usedWidth + slotSize.x <= pageSize.x)
+                 && (!bestShelf || (shelf.height < bestShelf->height)))
+                {
+                    bestShelf = &shelf;
+                }
+            }
+
+            if (!bestShelf)
+            {
+                const unsigned int shelfTop = page.shelves.empty() ? 0 : page.shelves.back().top + page.shelves.back().height;
+                if ((shelfTop + slotSize.y > pageSize.y) || (slotSize.x > pageSize.x))
+                    return false;
+
+                page.shelves.push_back({shelfTop, slotSize.y, 0});
+                bestShelf = &page.shelves.back();
+            }
+
+            slot = {bestShelf->usedWidth, bestShelf->top, slotSize.x, slotSize.y};
+            bestShelf->usedWidth += slotSize.x;
+            return true;
+        }
+
+        void copyImageToAtlas(AtlasPage& page, UIntRect slot, Vector2u imageSize, const std::uint8_t* pixels)
+        {
+            // Create the pixels of the slot, which contain the image with its edges extended into the padding
+            auto slotPixels = MakeUniqueForOverwrite<std::uint8_t[]>(slot.width * slot.height * 4);
+            for (unsigned int y = 0; y < slot.height; ++y)
+            {
+                const unsigned int srcY = std::min(std::max(y, atlasPadding) - atlasPadding, imageSize.y - 1);
+                const std::uint8_t* srcRow = &pixels[srcY * imageSize.x * 4];
+                std::uint8_t* dstRow = &slotPixels[y * slot.width * 4];
+                for (unsigned int x = 0; x < atlasPadding; ++x)
+                {
+                    std::memcpy(&dstRow[x * 4], srcRow, 4);
+                    std::memcpy(&dstRow[(slot.width - 1 - x) * 4], &srcRow[(imageSize.x - 1) * 4], 4);
+                }
+
+                std::memcpy(&dstRow[atlasPadding * 4], srcRow, imageSize.x * 4);
+            }
+
+            if (page.texture->updatePixels(slot, slotPixels.get()))
+                return;
+
+            // The backend doesn't support partial updates, so the entire page has to be reloaded
+            TGUI_ASSERT(page.texture->getPixels(), "Atlas pages without partial updates have to store all their pixels");
+            const Vector2u pageSize = page.texture->getSize();
+            auto pagePixels = MakeUniqueForOverwrite<std::uint8_t[]>(pageSize.x * pageSize.y * 4);
+            std::memcpy(pagePixels.get(), page.texture->getPixels(), pageSize.x * pageSize.y * 4);
+            for (unsigned int y = 0; y < slot.height; ++y)
+                std::memcpy(&pagePixels[((slot.top + y) * pageSize.x + slot.left) * 4], &slotPixels[y * slot.width * 4], slot.width * 4);
+
+            page.texture->load(pageSize, std::move(pagePixels), page.texture->isSmooth());
+        }
+
+        TGUI_NODISCARD bool loadImageIntoAtlas(TextureData& data, const Texture::BackendTextureLoaderFunc& loader, const String& filename, bool smooth)
+        {
+            // Load the pixels into a texture that only stores them, without creating a texture in the backend
+            BackendTexture pixelStorage;
+            pixelStorage.setPixelRetention(BackendTexture::PixelRetention::Full);
+            if (!loader(pixelStorage, filename, smooth) || !pixelStorage.getPixels())
+            {
+                // The loader didn't provide the pixels, so let it load the image into a texture of its own
+                data.backendTexture = getBackend()->createTexture();
+                return loader(*data.backendTexture, filename, smooth);
+            }
+
+            const Vector2u imageSize = pixelStorage.getSize();
+            const Vector2u slotSize = {imageSize.x + 2 * atlasPadding, imageSize.y + 2 * atlasPadding};
+            if ((imageSize.x > atlasMaxImageSize) || (imageSize.y > atlasMaxImageSize)
+             || (slotSize.x > atlasPageSize) || (slotSize.y > atlasPageSize))
+            {
+                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(imageSize.x * imageSize.y * 4);
+                std::memcpy(pixels.get(), pixelStorage.getPixels(), imageSize.x * imageSize.y * 4);
+
+                data.backendTexture = getBackend()->createTexture();
+                return data.backendTexture->load(imageSize, std::move(pixels), smooth);
+            }
+
+            UIntRect slot;
+            auto pageIt = std::find_if(atlasPages.begin(), atlasPages.end(), [&](AtlasPage& page)
+                { return (page.texture->isSmooth() == smooth) && allocateAtlasSlot(page, slotSize, slot); });
+            if (pageIt == atlasPages.end())
+            {
+                AtlasPage page;
+                page.texture = getBackend()->createTexture();
+                page.texture->setPixelRetention(BackendTexture::PixelRetention::Full);
+                if (!page.texture->load({atlasPageSize, atlasPageSize}, std::make_unique<std::uint8_t[]>(atlasPageSize * atlasPageSize * 4), smooth))
+                    return false;
+
+                // When the backend can update part of the page then the page doesn't need to keep a copy of all its pixels.
+                // The test overwrites a transparent pixel with a transparent pixel, so it doesn't change the contents.
+                const std::array<std::uint8_t, 4> transparentPixel{};
+                if (page.texture->updatePixels({0, 0, 1, 1}, transparentPixel.data()))
+                    page.texture->setPixelRetention(BackendTexture::getDefaultPixelRetention());
+
+                atlasPages.push_back(std::move(page));
+                pageIt = atlasPages.end() - 1;
+                if (!allocateAtlasSlot(*pageIt, slotSize, slot))
+                    return false;
+            }
+
+            copyImageToAtlas(*pageIt, slot, imageSize, pixelStorage.getPixels());
+            ++pageIt->imageCount;
+
+            data.backendTexture = pageIt->texture;
+            data.atlasRect = {slot.left + atlasPadding, slot.top + atlasPadding, imageSize.x, imageSize.y};
+            return true;
+        }
+
+        void removeImageFromAtlas(const TextureData& data)
+        {
+            const auto pageIt = std::find_if(atlasPages.begin(), atlasPages.end(),
+                [&](const AtlasPage& page){ return page.texture == data.backendTexture; });
+            if (pageIt == atlasPages.end())
+                return;
+
+            // Release the entire page when it no longer contains any images
+            if (--pageIt->imageCount == 0)
+            {
+                atlasPages.erase(pageIt);
+                return;
+            }
+
+            pageIt->freedSlots.push_back({data.atlasRect.left - atlasPadding, data.atlasRect.top - atlasPadding,
+                                          data.atlasRect.width + 2 * atlasPadding, data.atlasRect.height + 2 * atlasPadding});
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const String& filename, bool smooth)
@@ -80,7 +259,12 @@ namespace tgui
             if (data->svgImage->isSet())
                 return data;
         }
-        else // Not an svg
+        else if (atlasEnabled) // Not an svg, but the image might be placed on an atlas page
+        {
+            if (loadImageIntoAtlas(*data, texture.getBackendTextureLoader(), filename, smooth))
+                return data;
+        }
+        else // Not an svg and not part of an atlas
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
@@ -133,6 +317,9 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        if (dataIt->data->atlasRect != UIntRect{})
+                            removeImageFromAtlas(*dataIt->data);
+
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -154,6 +341,56 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasMaxImageSize(unsigned int size)
+    {
+        atlasMaxImageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasMaxImageSize()
+    {
+        return atlasMaxImageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPageSize(unsigned int size)
+    {
+        TGUI_ASSERT(size > 0, "Atlas page size can't be 0");
+        atlasPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageSize()
+    {
+        return atlasPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return atlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
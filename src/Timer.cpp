@@ -25,7 +25,7 @@
 #include <TGUI/Timer.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
-    #include <algorithm>
+    #include <utility>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    Duration Timer::m_currentTime;
+    std::uint64_t Timer::m_lastScheduleSequence = 0;
+    bool Timer::m_coalescingEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,21 +108,11 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
-        {
-            if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
-            {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
-            }
-        }
-
         m_enabled = enabled;
         if (enabled)
-            restart();
+            schedule(); // Also restarts the timer when it was already running
+        else
+            unschedule();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,31 +140,59 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        if (m_enabled)
+            schedule();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::setCoalescingEnabled(bool coalesce)
+    {
+        m_coalescingEnabled = coalesce;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Timer::isCoalescingEnabled()
+    {
+        return m_coalescingEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Timer::updateTime(Duration elapsedTime)
     {
-        if (m_activeTimers.empty())
+        m_currentTime += elapsedTime;
+        if (m_activeTimers.empty() || (m_activeTimers[0]->m_deadline > m_currentTime))
             return false;
 
+        // Take all expired timers out of the queue before calling any callback, as the callbacks could start and stop timers.
+        // A timer that is started from within a callback thus won't be triggered before the next update.
+        std::vector<std::shared_ptr<Timer>> expiredTimers;
+        while (!m_activeTimers.empty() && (m_activeTimers[0]->m_deadline <= m_currentTime))
+        {
+            expiredTimers.push_back(m_activeTimers[0]);
+            m_activeTimers[0]->unschedule();
+        }
+
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        for (auto& timer : expiredTimers)
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
+            // Skip the timer if the callback of another timer stopped or restarted it
+            if (!timer->m_enabled || (timer->m_queueIndex != notQueued))
+                continue;
+
+            timerTriggered = true;
+            timer->m_callback();
+
+            // The callback may also have stopped or restarted the timer itself
+            if (!timer->m_enabled || (timer->m_queueIndex != notQueued))
+                continue;
+
+            if (timer->m_repeats)
+                timer->schedule();
             else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
-
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
-            }
+                timer->m_enabled = false;
         }
 
         return timerTriggered;
@@ -185,22 +206,128 @@ namespace tgui
         if (m_activeTimers.empty())
             return {};
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        // The timer that expires first is always at the front of the queue
+        const Duration deadline = m_activeTimers[0]->m_deadline;
+        if (deadline > m_currentTime)
+            return deadline - m_currentTime;
+        else
+            return Duration{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& timer : m_activeTimers)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            timer->m_enabled = false;
+            timer->m_queueIndex = notQueued;
         }
 
-        return minDuration;
+        m_activeTimers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::schedule()
     {
-        m_activeTimers.clear();
+        m_deadline = m_currentTime + m_interval;
+
+        // Round the deadline up to a multiple of the largest power of two milliseconds that doesn't exceed 1/16th of the interval.
+        // Timers with similar intervals use the same granularity, so that their deadlines end up at the same moments.
+        if (m_coalescingEnabled && (m_interval >= std::chrono::milliseconds(16)))
+        {
+            Duration granularity = std::chrono::milliseconds(1);
+            while (granularity * 2 <= m_interval / 16)
+                granularity *= 2;
+
+            const Duration remainder = m_deadline % granularity;
+            if (remainder > Duration{})
+                m_deadline += granularity - remainder;
+        }
+
+        m_scheduleSequence = ++m_lastScheduleSequence;
+
+        if (m_queueIndex == notQueued)
+        {
+            m_queueIndex = m_activeTimers.size();
+            m_activeTimers.push_back(shared_from_this());
+        }
+
+        updateQueuePosition(m_queueIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::unschedule()
+    {
+        if (m_queueIndex == notQueued)
+            return;
+
+        const std::size_t index = m_queueIndex;
+        m_queueIndex = notQueued;
+
+        // Keep the timer alive until the end of this function, the queue might have been the last owner
+        const std::shared_ptr<Timer> self = std::move(m_activeTimers[index]);
+
+        // Fill the gap with the last timer in the queue and move that timer to its correct place
+        if (index + 1 < m_activeTimers.size())
+        {
+            m_activeTimers[index] = std::move(m_activeTimers.back());
+            m_activeTimers[index]->m_queueIndex = index;
+            m_activeTimers.pop_back();
+            updateQueuePosition(index);
+        }
+        else
+            m_activeTimers.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::updateQueuePosition(std::size_t index)
+    {
+        // Move the timer up while it expires before its parent
+        while (index > 0)
+        {
+            const std::size_t parentIndex = (index - 1) / 2;
+            if (!expiresBefore(*m_activeTimers[index], *m_activeTimers[parentIndex]))
+                break;
+
+            std::swap(m_activeTimers[index], m_activeTimers[parentIndex]);
+            m_activeTimers[index]->m_queueIndex = index;
+            m_activeTimers[parentIndex]->m_queueIndex = parentIndex;
+            index = parentIndex;
+        }
+
+        // Move the timer down while one of its children expires before it
+        while (true)
+        {
+            std::size_t firstIndex = index;
+            const std::size_t leftChildIndex = 2 * index + 1;
+            const std::size_t rightChildIndex = 2 * index + 2;
+            if ((leftChildIndex < m_activeTimers.size()) && expiresBefore(*m_activeTimers[leftChildIndex], *m_activeTimers[firstIndex]))
+                firstIndex = leftChildIndex;
+            if ((rightChildIndex < m_activeTimers.size()) && expiresBefore(*m_activeTimers[rightChildIndex], *m_activeTimers[firstIndex]))
+                firstIndex = rightChildIndex;
+
+            if (firstIndex == index)
+                break;
+
+            std::swap(m_activeTimers[index], m_activeTimers[firstIndex]);
+            m_activeTimers[index]->m_queueIndex = index;
+            m_activeTimers[firstIndex]->m_queueIndex = firstIndex;
+            index = firstIndex;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Timer::expiresBefore(const Timer& left, const Timer& right)
+    {
+        if (left.m_deadline != right.m_deadline)
+            return left.m_deadline < right.m_deadline;
+        else
+            return left.m_scheduleSequence < right.m_scheduleSequence;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
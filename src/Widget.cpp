@@ -154,6 +154,8 @@ namespace tgui
         for (auto& layout : m_boundSizeLayouts)
             layout->unbindWidget();
 
+        forgetDeferredLayout();
+
         SignalManager::getSignalManager()->remove(this);
     }
 
@@ -253,6 +255,9 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
+        // The new widget isn't part of a gui yet, so the changes that the old widget had queued in its gui are dropped
+        other.forgetDeferredLayout();
+
         other.m_renderer->unsubscribe(&other);
         m_renderer->subscribe(this);
 
@@ -270,6 +275,9 @@ namespace tgui
         {
             m_renderer->unsubscribe(this);
 
+            // The widget is no longer part of its gui after the assignment, so it can't stay in the deferred layout queues
+            forgetDeferredLayout();
+
             enable_shared_from_this::operator=(other);
 
             onPositionChange.disconnectAll();
@@ -342,6 +350,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
 
+            // Neither widget is part of a gui after the assignment, so the changes that were queued in their guis are dropped
+            forgetDeferredLayout();
+            other.forgetDeferredLayout();
+
             onPositionChange       = std::move(other.onPositionChange);
             onSizeChange           = std::move(other.onSizeChange);
             onFocus                = std::move(other.onFocus);
@@ -579,9 +591,18 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            if (isLayoutDeferred())
+            {
+                deferLayoutChange(DeferredPositionChange);
+                return;
+            }
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
+            if (m_parent)
+                m_parent->invalidateSpatialIndex();
+
             recalculateBoundPositionLayouts();
 
             if ((m_autoLayout != AutoLayout::Manual) && m_autoLayoutUpdateEnabled && m_parent)
@@ -599,9 +620,18 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            if (isLayoutDeferred())
+            {
+                deferLayoutChange(DeferredSizeChange);
+                return;
+            }
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
+            if (m_parent)
+                m_parent->invalidateSpatialIndex();
+
             recalculateBoundSizeLayouts();
 
             // If the origin isn't in the top left then changing the size also changes the position of the widget.
@@ -684,6 +714,8 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -692,6 +724,8 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -700,6 +734,8 @@ namespace tgui
     {
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -718,6 +754,8 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -726,6 +764,8 @@ namespace tgui
     {
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1318,7 +1358,17 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
-        m_parentGui = parent ? parent->getParentGui() : nullptr;
+        BackendGui* const parentGui = parent ? parent->getParentGui() : nullptr;
+        if (m_parentGui && (m_parentGui != parentGui) && (m_deferredLayoutChanges || m_deferredLayoutSignalsPending))
+        {
+            // The old gui can no longer reach this widget, so finish the pending changes while we still belong to it.
+            // If the gui is already processing its queue (e.g. we are being removed from inside a signal handler)
+            // then the remaining changes are dropped.
+            m_parentGui->updateLayouts();
+            forgetDeferredLayout();
+        }
+
+        m_parentGui = parentGui;
         if (m_parent == parent)
             return;
 
@@ -1363,6 +1413,10 @@ namespace tgui
                 ++it;
         }
 
+        // Make sure the main loop keeps drawing frames while the animation is still running
+        if (!m_showAnimations.empty() && m_parentGui)
+            m_parentGui->scheduleUpdate(std::chrono::milliseconds(15));
+
         return screenRefreshRequired;
     }
 
@@ -1856,6 +1910,101 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::updateDeferredLayout()
+    {
+        // The flags are reset first, so that a change that is caused by recalculating the layouts queues the widget again
+        const unsigned int changes = m_deferredLayoutChanges;
+        m_deferredLayoutChanges = 0;
+
+        if (changes & DeferredSizeChange)
+            recalculateBoundSizeLayouts();
+
+        // If the origin isn't in the top left then changing the size also changes the left and top of the widget
+        if ((changes & DeferredPositionChange) || ((changes & DeferredSizeChange) && ((m_origin.x != 0) || (m_origin.y != 0))))
+            recalculateBoundPositionLayouts();
+
+        if ((changes & DeferredParentAutoLayout) && m_parent)
+            m_parent->updateChildrenWithAutoLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::emitDeferredLayoutSignals()
+    {
+        m_deferredLayoutSignalsPending = false;
+
+        if (getPosition() != m_positionBeforeDeferral)
+            onPositionChange.emit(this, getPosition());
+        if (getSize() != m_sizeBeforeDeferral)
+            onSizeChange.emit(this, getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::cancelDeferredLayout()
+    {
+        m_deferredLayoutChanges = 0;
+        m_deferredLayoutSignalsPending = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isLayoutDeferred() const
+    {
+        return m_parentGui && m_parentGui->isDeferredLayoutEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::queueDeferredLayoutChanges(unsigned int changes)
+    {
+        TGUI_ASSERT(m_parentGui, "Widget::queueDeferredLayoutChanges can only be called when the widget is part of a gui");
+
+        if (m_deferredLayoutChanges == 0)
+            m_deferredLayoutUpdateIndex = m_parentGui->queueDeferredLayoutUpdate(this);
+
+        m_deferredLayoutChanges |= changes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::deferLayoutChange(DeferredLayoutChange change)
+    {
+        // The signals compare against the position and size from before the first deferred change
+        if (!m_deferredLayoutSignalsPending)
+        {
+            m_positionBeforeDeferral = m_prevPosition;
+            m_sizeBeforeDeferral = m_prevSize;
+            m_deferredLayoutSignalsPending = true;
+            m_deferredLayoutSignalsIndex = m_parentGui->queueDeferredLayoutSignals(this);
+        }
+
+        if (change == DeferredPositionChange)
+            m_prevPosition = getPosition();
+        else
+            m_prevSize = getSize();
+
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
+
+        if ((m_autoLayout != AutoLayout::Manual) && m_autoLayoutUpdateEnabled && m_parent)
+            queueDeferredLayoutChanges(change | DeferredParentAutoLayout);
+        else
+            queueDeferredLayoutChanges(change);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::forgetDeferredLayout()
+    {
+        if (m_parentGui && (m_deferredLayoutChanges || m_deferredLayoutSignalsPending))
+            m_parentGui->forgetDeferredLayoutWidget(this, m_deferredLayoutUpdateIndex, m_deferredLayoutSignalsIndex);
+
+        cancelDeferredLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::mouseEnteredWidget()
     {
         if (m_parentGui && (m_mouseCursor != Cursor::Type::Arrow))
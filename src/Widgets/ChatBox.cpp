@@ -24,6 +24,10 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -145,10 +149,18 @@ namespace tgui
 
         recalculateLineText(line);
 
+        // Only the position of the new line has to be calculated, the other lines keep their positions
         if (m_newLinesBelowOthers)
+        {
+            line.top = m_linesBottom;
+            m_linesBottom += static_cast<double>(line.text.getSize().y);
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            line.top = (m_lines.empty() ? m_linesBottom : m_lines.front().top) - static_cast<double>(line.text.getSize().y);
             m_lines.push_front(std::move(line));
+        }
 
         recalculateFullTextHeight();
     }
@@ -193,6 +205,24 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
+            // Move the lines on the side with the fewest lines to fill the gap that is left behind by the removed line
+            if (lineIndex + 1 == m_lines.size())
+                m_linesBottom = m_lines.back().top;
+            else if (lineIndex > m_lines.size() / 2)
+            {
+                const auto lineHeight = static_cast<double>(m_lines[lineIndex].text.getSize().y);
+                for (std::size_t i = lineIndex + 1; i < m_lines.size(); ++i)
+                    m_lines[i].top -= lineHeight;
+
+                m_linesBottom -= lineHeight;
+            }
+            else
+            {
+                const auto lineHeight = static_cast<double>(m_lines[lineIndex].text.getSize().y);
+                for (std::size_t i = 0; i < lineIndex; ++i)
+                    m_lines[i].top += lineHeight;
+            }
+
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
             recalculateFullTextHeight();
@@ -207,6 +237,7 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_linesBottom = 0;
 
         recalculateFullTextHeight();
     }
@@ -230,7 +261,10 @@ namespace tgui
             if (m_newLinesBelowOthers)
                 m_lines.erase(m_lines.begin(), m_lines.begin() + static_cast<std::ptrdiff_t>(m_lines.size() - m_maxLines));
             else
+            {
+                m_linesBottom = m_lines[m_maxLines].top;
                 m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(m_maxLines), m_lines.end());
+            }
 
             recalculateFullTextHeight();
         }
@@ -428,16 +462,30 @@ namespace tgui
         for (auto& line : m_lines)
             recalculateLineText(line);
 
+        recalculateLineTops();
         recalculateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::recalculateLineTops()
+    {
+        m_linesBottom = 0;
+        for (auto& line : m_lines)
+        {
+            line.top = m_linesBottom;
+            m_linesBottom += static_cast<double>(line.text.getSize().y);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        if (!m_lines.empty())
+            m_fullTextHeight = static_cast<float>(m_linesBottom - m_lines.front().top);
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -645,10 +693,24 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate({0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached)});
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that are inside the visible area, starting with the line that contains the top of the visible area
+        if (!m_lines.empty())
         {
-            target.drawText(states, line.text);
-            states.transform.translate({0, line.text.getSize().y});
+            const double firstLineTop = m_lines.front().top;
+            const double visibleTop = firstLineTop + m_scroll->getValue();
+            const double visibleBottom = visibleTop + static_cast<double>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom());
+
+            auto lineIt = std::upper_bound(m_lines.begin(), m_lines.end(), visibleTop,
+                                           [](double value, const Line& line){ return value < line.top; });
+            if (lineIt != m_lines.begin())
+                --lineIt;
+
+            states.transform.translate({0, static_cast<float>(lineIt->top - firstLineTop)});
+            for (; (lineIt != m_lines.end()) && (lineIt->top < visibleBottom); ++lineIt)
+            {
+                target.drawText(states, lineIt->text);
+                states.transform.translate({0, lineIt->text.getSize().y});
+            }
         }
 
         target.removeClippingLayer();
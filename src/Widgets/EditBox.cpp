@@ -1351,9 +1351,15 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
             // Too slow for double clicking
             m_possibleDoubleClick = false;
 
-            screenRefreshRequired = true;
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                screenRefreshRequired = true;
         }
 
+        // Make sure the main loop wakes up again when the caret has to blink
+        if (m_focused && m_parentGui)
+            m_parentGui->scheduleUpdate(getEditCursorBlinkRate() - m_animationTimeElapsed);
+
         return screenRefreshRequired;
     }
 
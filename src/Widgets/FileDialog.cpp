@@ -24,6 +24,7 @@
 
 #include <TGUI/Widgets/FileDialog.hpp>
 #include <TGUI/FileDialogIconLoader.hpp>
+#include <TGUI/Backend/Window/BackendGui.hpp>
 
 #if TGUI_EXPERIMENTAL_USE_STD_MODULE
     #ifdef TGUI_SYSTEM_WINDOWS
@@ -666,17 +667,22 @@ namespace tgui
     {
         const bool childWidgetUpdated = ChildWindow::updateTime(elapsedTime);
 
-        if (!m_iconLoader->update())
-            return childWidgetUpdated;
+        const bool iconsLoaded = m_iconLoader->update();
+        if (iconsLoaded)
+        {
+            m_fileIcons = m_iconLoader->retrieveFileIcons();
 
-        m_fileIcons = m_iconLoader->retrieveFileIcons();
+            const int oldSelectedItem = m_listView->getSelectedItemIndex();
+            sortFilesInListView();
+            if (oldSelectedItem >= 0)
+                m_listView->setSelectedItem(static_cast<std::size_t>(oldSelectedItem));
+        }
 
-        const int oldSelectedItem = m_listView->getSelectedItemIndex();
-        sortFilesInListView();
-        if (oldSelectedItem >= 0)
-            m_listView->setSelectedItem(static_cast<std::size_t>(oldSelectedItem));
+        // Icons are loaded in a background thread, so we have to keep checking whether they are available
+        if (m_iconLoader->isLoading() && m_parentGui)
+            m_parentGui->scheduleUpdate(std::chrono::milliseconds(100));
 
-        return true;
+        return childWidgetUpdated || iconsLoaded;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
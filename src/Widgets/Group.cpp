@@ -117,6 +117,18 @@ namespace tgui
         if (FloatRect{0, 0, getSize().x, getSize().y}.contains(pos))
         {
             const Vector2f offset = getChildWidgetsOffset();
+            if (isSpatialIndexEnabled())
+            {
+                for (const std::size_t index : getSpatialIndexCandidates(pos - offset))
+                {
+                    const auto& widget = m_widgets[index];
+                    if (widget->isVisible() && widget->isMouseOnWidget(transformMousePos(widget, pos - offset)))
+                        return true;
+                }
+
+                return false;
+            }
+
             for (const auto& widget : m_widgets)
             {
                 if (widget->isVisible())
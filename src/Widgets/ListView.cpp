@@ -28,7 +28,18 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <numeric>
+    #include <limits>
+    #include <thread>
+    #include <system_error>
     #include <cmath>
+
+    #if (TGUI_COMPILED_WITH_CPP_VER >= 17) && defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+        #include <charconv> // from_chars
+    #else
+        #include <sstream>
+    #endif
 #endif
 
 #if TGUI_HAS_WINDOW_BACKEND_SFML
@@ -45,6 +56,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Converts the text to a number, without allocating memory. Returns false if the text contains anything else.
+        bool parseSortNumber(const String& text, double& number)
+        {
+            char buffer[64];
+            std::size_t length = 0;
+            for (const char32_t c : text)
+            {
+                if ((c == U' ') || (c == U'\t'))
+                    continue;
+                if ((c > 127) || (length + 1 >= sizeof(buffer)))
+                    return false;
+
+                buffer[length++] = static_cast<char>(c);
+            }
+
+            if (length == 0)
+                return false;
+
+#if (TGUI_COMPILED_WITH_CPP_VER >= 17) && defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+            // from_chars doesn't accept a plus sign
+            const char* const begin = (buffer[0] == '+') ? buffer + 1 : buffer;
+            const char* const end = buffer + length;
+            const auto result = std::from_chars(begin, end, number);
+            return (result.ec == std::errc{}) && (result.ptr == end) && !std::isnan(number);
+#else
+            // We can't use std::strtod because it depends on the global locale
+            std::istringstream iss(std::string(buffer, length));
+            iss.imbue(std::locale::classic());
+            iss >> number;
+            return !iss.fail() && (iss.peek() == std::char_traits<char>::eof()) && !std::isnan(number);
+#endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Sorts the indices, splitting the work over multiple threads if there are many of them.
+        // The comparison function has to be safe to call from multiple threads at the same time.
+        template <typename LessFunc>
+        void sortIndicesInParallel(std::vector<std::size_t>& indices, const LessFunc& less)
+        {
+            // Starting threads isn't worth it when there are only a few items
+            const std::size_t minItemsPerThread = 20000;
+            const std::size_t threadCount = std::min({static_cast<std::size_t>(std::thread::hardware_concurrency()),
+                                                      indices.size() / minItemsPerThread, std::size_t(8)});
+            if (threadCount <= 1)
+            {
+                std::sort(indices.begin(), indices.end(), less);
+                return;
+            }
+
+            const auto runTasks = [](std::size_t taskCount, const std::function<void(std::size_t)>& task) {
+                std::vector<std::thread> threads;
+                threads.reserve(taskCount - 1);
+                for (std::size_t i = 1; i < taskCount; ++i)
+                {
+                    try
+                    {
+                        threads.emplace_back(task, i);
+                    }
+                    catch (const std::system_error&)
+                    {
+                        // If no more threads can be started then the task is executed on the current thread
+                        task(i);
+                    }
+                }
+
+                task(0);
+                for (auto& thread : threads)
+                    thread.join();
+            };
+
+            // Sort equally sized chunks in parallel and then merge them in pairs
+            std::vector<std::ptrdiff_t> chunkBounds(threadCount + 1);
+            for (std::size_t i = 0; i <= threadCount; ++i)
+                chunkBounds[i] = static_cast<std::ptrdiff_t>(indices.size() * i / threadCount);
+
+            const auto begin = indices.begin();
+            runTasks(threadCount, [&](std::size_t chunk){
+                std::sort(begin + chunkBounds[chunk], begin + chunkBounds[chunk + 1], less);
+            });
+
+            for (std::size_t width = 1; width < threadCount; width *= 2)
+            {
+                runTasks((threadCount + (2 * width) - 1) / (2 * width), [&](std::size_t pair){
+                    const std::size_t firstChunk = pair * 2 * width;
+                    if (firstChunk + width >= threadCount)
+                        return;
+
+                    std::inplace_merge(begin + chunkBounds[firstChunk],
+                                       begin + chunkBounds[firstChunk + width],
+                                       begin + chunkBounds[std::min(firstChunk + (2 * width), threadCount)],
+                                       less);
+                });
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListView::ListView(const char* typeName, bool initRenderer) :
         Widget{typeName, false}
     {
@@ -369,6 +483,8 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        TGUI_ASSERT(!m_virtualCellProvider, "ListView::addItem can't be called when the list view has virtual items");
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -389,6 +505,8 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        TGUI_ASSERT(!m_virtualCellProvider, "ListView::addItem can't be called when the list view has virtual items");
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -412,6 +530,8 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        TGUI_ASSERT(!m_virtualCellProvider, "ListView::addMultipleItems can't be called when the list view has virtual items");
+
         bool columnWidthChanged = false;
         for (const auto& itemToInsert : items)
         {
@@ -716,6 +836,12 @@ namespace tgui
 
         m_items.clear();
 
+        m_virtualCellProvider = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItemOrder.clear();
+        m_virtualItemPool.clear();
+        m_virtualItemPoolStart = 0;
+
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
 
@@ -727,9 +853,105 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setVirtualItems(std::size_t itemCount, std::function<String(std::size_t, std::size_t)> cellProvider)
+    {
+        removeAllItems();
+        if (!cellProvider)
+            return;
+
+        m_virtualCellProvider = std::move(cellProvider);
+        m_virtualItemCount = itemCount;
+
+        // The empty list has its scrollbar at the bottom, which we don't want to preserve here as the list should start at the top.
+        // Updating the scrollbar will also request the texts of the visible items.
+        m_verticalScrollbar->setMaximum(static_cast<unsigned int>(itemCount * m_itemHeight));
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVirtualItemCount(std::size_t itemCount)
+    {
+        if (!m_virtualCellProvider)
+            return;
+
+        const std::size_t oldItemCount = m_virtualItemCount;
+        if (itemCount < oldItemCount)
+        {
+            if ((m_hoveredItem >= 0) && (static_cast<std::size_t>(m_hoveredItem) >= itemCount))
+                updateHoveredItem(-1);
+
+            if (!m_selectedItems.empty() && (*m_selectedItems.rbegin() >= itemCount))
+            {
+                std::set<std::size_t> selectedItems = m_selectedItems;
+                selectedItems.erase(selectedItems.lower_bound(itemCount), selectedItems.end());
+                if (m_multiSelect)
+                    setSelectedItems(selectedItems);
+                else
+                    updateSelectedItem(-1);
+            }
+
+            if (m_focusedItemIndex >= static_cast<int>(itemCount))
+                m_focusedItemIndex = -1;
+            if (m_firstSelectedItemIndex >= static_cast<int>(itemCount))
+                m_firstSelectedItemIndex = -1;
+
+            // Items that no longer exist have to be removed from the sort order
+            if (!m_virtualItemOrder.empty())
+            {
+                m_virtualItemOrder.erase(std::remove_if(m_virtualItemOrder.begin(), m_virtualItemOrder.end(),
+                                                        [itemCount](std::size_t index){ return index >= itemCount; }),
+                                         m_virtualItemOrder.end());
+            }
+        }
+        else if (!m_virtualItemOrder.empty())
+        {
+            for (std::size_t i = oldItemCount; i < itemCount; ++i)
+                m_virtualItemOrder.push_back(i);
+        }
+
+        m_virtualItemCount = itemCount;
+        m_virtualItemPool.clear();
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (itemCount > oldItemCount) && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+        {
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+            updateVirtualItemPool();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::refreshVirtualItems()
+    {
+        m_virtualItemPool.clear();
+        updateVirtualItemPool();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isVirtual() const
+    {
+        return static_cast<bool>(m_virtualCellProvider);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getVirtualItemIndex(std::size_t index) const
+    {
+        if (index < m_virtualItemOrder.size())
+            return m_virtualItemOrder[index];
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -742,6 +964,8 @@ namespace tgui
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
         else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        updateVirtualItemPool();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -907,19 +1131,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_virtualCellProvider)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_virtualCellProvider)
+            return m_virtualCellProvider(getVirtualItemIndex(rowIndex), columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -930,6 +1160,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_virtualCellProvider)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -944,7 +1177,15 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_virtualCellProvider)
+        {
+            if (index < m_virtualItemCount)
+            {
+                for (std::size_t column = 0; column < std::max<std::size_t>(1, m_columns.size()); ++column)
+                    row.push_back(m_virtualCellProvider(getVirtualItemIndex(index), column));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -958,34 +1199,77 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
-        if (index >= m_items.size())
+        if (index >= std::max<std::size_t>(1, m_columns.size()))
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
-            {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+        // Indices are sorted instead of the items themselves, so that the items only have to be moved once
+        std::vector<String> textStorage;
+        const std::vector<const String*> texts = getColumnTexts(index, textStorage);
+
+        std::vector<std::size_t> order(texts.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        std::sort(order.begin(), order.end(),
+            [&texts, &cmp](std::size_t a, std::size_t b){ return cmp(*texts[a], *texts[b]); });
+
+        applyItemOrder(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortByColumn(std::size_t index, bool ascending)
+    {
+        if (index >= std::max<std::size_t>(1, m_columns.size()))
+            return;
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+        std::vector<String> textStorage;
+        const std::vector<const String*> texts = getColumnTexts(index, textStorage);
+
+        std::vector<std::size_t> order(texts.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+
+        // Comparing the item indices when the values are equal keeps the sort stable
+        std::vector<double> numbers(texts.size());
+        bool numeric = true;
+        for (std::size_t i = 0; (i < texts.size()) && numeric; ++i)
+        {
+            if (texts[i]->empty())
+                numbers[i] = -std::numeric_limits<double>::infinity();
+            else
+                numeric = parseSortNumber(*texts[i], numbers[i]);
+        }
 
-                return cmp(s1, s2);
+        if (numeric)
+        {
+            sortIndicesInParallel(order, [&numbers, ascending](std::size_t a, std::size_t b){
+                if (numbers[a] < numbers[b])
+                    return ascending;
+                if (numbers[b] < numbers[a])
+                    return !ascending;
+                return a < b;
+            });
+        }
+        else
+        {
+            sortIndicesInParallel(order, [&texts, ascending](std::size_t a, std::size_t b){
+                const int comparison = texts[a]->compare(*texts[b]);
+                if (comparison < 0)
+                    return ascending;
+                if (comparison > 0)
+                    return !ascending;
+                return a < b;
             });
+        }
 
-        // While the width of the widest item didn't change, its index might have, so we need to locate it again
-        updateWidestItem();
+        applyItemOrder(order);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -997,6 +1281,15 @@ namespace tgui
     {
         std::vector<std::vector<String>> rows;
 
+        if (m_virtualCellProvider)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<String> row;
@@ -1043,6 +1336,12 @@ namespace tgui
                 text.setCharacterSize(m_textSizeCached);
         }
 
+        for (auto& item : m_virtualItemPool)
+        {
+            for (auto& text : item.texts)
+                text.setCharacterSize(m_textSizeCached);
+        }
+
         if (!m_headerTextSize)
         {
             const unsigned int headerTextSize = getHeaderTextSize();
@@ -1275,6 +1574,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        updateVirtualItemPool();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1391,6 +1691,7 @@ namespace tgui
         if (m_verticalScrollbar->isMouseOnWidget(pos))
         {
             isDragging = m_verticalScrollbar->leftMousePressed(pos);
+            updateVirtualItemPool();
         }
         else if (m_horizontalScrollbar->isShown() && m_horizontalScrollbar->isMouseOnWidget(pos))
         {
@@ -1462,7 +1763,10 @@ namespace tgui
         pos -= getPosition();
 
         if (m_verticalScrollbar->isShown() && m_verticalScrollbar->isMouseDown())
+        {
             m_verticalScrollbar->leftMouseReleased(pos);
+            updateVirtualItemPool();
+        }
 
         if (m_horizontalScrollbar->isShown() && m_horizontalScrollbar->isMouseDown())
             m_horizontalScrollbar->leftMouseReleased(pos);
@@ -1548,6 +1852,7 @@ namespace tgui
         else if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->isMouseOnWidget(pos))
         {
             m_verticalScrollbar->mouseMoved(pos);
+            updateVirtualItemPool();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->isMouseOnWidget(pos))
         {
@@ -1629,6 +1934,7 @@ namespace tgui
         else if (m_verticalScrollbar->isShown())
         {
             scrollbarMoved = m_verticalScrollbar->scrolled(delta, pos - getPosition(), touch);
+            updateVirtualItemPool();
         }
 
         if (scrollbarMoved)
@@ -1683,7 +1989,7 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(getItemCount())))
         {
             const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
             if (m_multiSelect && keyboard::isShiftPressed(event))
@@ -1706,8 +2012,16 @@ namespace tgui
             for (const std::size_t index : m_selectedItems)
             {
                 String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                if (m_virtualCellProvider)
+                {
+                    for (const auto& cell : getItemRow(index))
+                        temp.append(cell + '\t');
+                }
+                else
+                {
+                    for (const auto& text : m_items[index].texts)
+                        temp.append(text.getString() + '\t');
+                }
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1867,6 +2181,12 @@ namespace tgui
 
                 item.icon.setOpacity(m_opacityCached);
             }
+
+            for (auto& item : m_virtualItemPool)
+            {
+                for (auto& text : item.texts)
+                    text.setOpacity(m_opacityCached);
+            }
         }
         else if (property == U"Font")
         {
@@ -1881,6 +2201,12 @@ namespace tgui
                     text.setFont(m_fontCached);
             }
 
+            for (auto& item : m_virtualItemPool)
+            {
+                for (auto& text : item.texts)
+                    text.setFont(m_fontCached);
+            }
+
             if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             {
                 // Recalculate the text size with the new font
@@ -2224,8 +2550,20 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
-        for (auto& text : m_items[index].texts)
-            text.setColor(color);
+        if (m_virtualCellProvider)
+        {
+            // Only the visible virtual items have texts
+            if ((index < m_virtualItemPoolStart) || (index >= m_virtualItemPoolStart + m_virtualItemPool.size()))
+                return;
+
+            for (auto& text : m_virtualItemPool[index - m_virtualItemPoolStart].texts)
+                text.setColor(color);
+        }
+        else
+        {
+            for (auto& text : m_items[index].texts)
+                text.setColor(color);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2261,6 +2599,9 @@ namespace tgui
         for (std::size_t i = 0; i < m_items.size(); ++i)
             setItemColor(i, m_textColorCached);
 
+        for (std::size_t i = 0; i < m_virtualItemPool.size(); ++i)
+            setItemColor(m_virtualItemPoolStart + i, m_textColorCached);
+
         updateSelectedAndhoveredItemColors();
     }
 
@@ -2629,7 +2970,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -2797,6 +3138,8 @@ namespace tgui
             if (hasExpandedColumn())
                 updateColumnWidths();
         }
+
+        updateVirtualItemPool();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2805,9 +3148,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2815,6 +3159,146 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        updateVirtualItemPool();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::findVisibleItems(std::size_t& firstItem, std::size_t& lastItem) const
+    {
+        const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
+
+        firstItem = 0;
+        lastItem = getItemCount();
+        if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+        {
+            firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
+            lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
+            if (lastItem > getItemCount())
+                lastItem = getItemCount();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVirtualItemPool()
+    {
+        if (!m_virtualCellProvider)
+            return;
+
+        std::size_t firstItem;
+        std::size_t lastItem;
+        findVisibleItems(firstItem, lastItem);
+        if (firstItem > lastItem)
+            firstItem = lastItem;
+
+        // All items need new texts when the amount of columns changed
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        if (!m_virtualItemPool.empty() && (m_virtualItemPool.front().texts.size() != columnCount))
+            m_virtualItemPool.clear();
+
+        const std::size_t oldPoolStart = m_virtualItemPoolStart;
+        const std::size_t oldPoolEnd = m_virtualItemPoolStart + m_virtualItemPool.size();
+        if ((firstItem == oldPoolStart) && (lastItem == oldPoolEnd))
+            return;
+
+        // Move the items that remain visible to their new location in the pool, so that their texts don't have to be recreated
+        std::size_t keptStart = std::max(firstItem, oldPoolStart);
+        std::size_t keptEnd = std::min(lastItem, oldPoolEnd);
+        if (keptStart >= keptEnd)
+            keptStart = keptEnd = firstItem;
+        else if (firstItem >= oldPoolStart)
+            std::rotate(m_virtualItemPool.begin(), m_virtualItemPool.begin() + static_cast<std::ptrdiff_t>(firstItem - oldPoolStart), m_virtualItemPool.end());
+        else
+        {
+            const std::size_t shift = oldPoolStart - firstItem;
+            m_virtualItemPool.resize(m_virtualItemPool.size() + shift);
+            std::rotate(m_virtualItemPool.begin(), m_virtualItemPool.end() - static_cast<std::ptrdiff_t>(shift), m_virtualItemPool.end());
+        }
+
+        m_virtualItemPool.resize(lastItem - firstItem);
+        m_virtualItemPoolStart = firstItem;
+
+        // Fill the items that weren't visible yet, reusing the text objects of items that are no longer visible
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if ((i >= keptStart) && (i < keptEnd))
+                continue;
+
+            auto& item = m_virtualItemPool[i - firstItem];
+            const std::size_t itemIndex = getVirtualItemIndex(i);
+            for (std::size_t column = 0; column < item.texts.size(); ++column)
+            {
+                item.texts[column].setString(m_virtualCellProvider(itemIndex, column));
+                item.texts[column].setColor(m_textColorCached);
+            }
+            for (std::size_t column = item.texts.size(); column < columnCount; ++column)
+                item.texts.push_back(createText(m_virtualCellProvider(itemIndex, column)));
+
+            const bool selected = (m_selectedItems.find(i) != m_selectedItems.end());
+            const bool hovered = (static_cast<int>(i) == m_hoveredItem);
+            if (selected && hovered && m_selectedTextColorHoverCached.isSet())
+                setItemColor(i, m_selectedTextColorHoverCached);
+            else if (selected && m_selectedTextColorCached.isSet())
+                setItemColor(i, m_selectedTextColorCached);
+            else if (hovered && m_textColorHoverCached.isSet())
+                setItemColor(i, m_textColorHoverCached);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<const String*> ListView::getColumnTexts(std::size_t column, std::vector<String>& storage) const
+    {
+        static const String emptyText;
+        std::vector<const String*> texts(getItemCount(), &emptyText);
+
+        if (m_virtualCellProvider)
+        {
+            storage.resize(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+            {
+                storage[i] = m_virtualCellProvider(getVirtualItemIndex(i), column);
+                texts[i] = &storage[i];
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (column < m_items[i].texts.size())
+                    texts[i] = &m_items[i].texts[column].getString();
+            }
+        }
+
+        return texts;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::applyItemOrder(std::vector<std::size_t>& order)
+    {
+        if (m_virtualCellProvider)
+        {
+            // The items aren't stored, so only the order of the indices that are passed to the cell provider is changed
+            for (auto& index : order)
+                index = getVirtualItemIndex(index);
+
+            m_virtualItemOrder = std::move(order);
+            refreshVirtualItems();
+            return;
+        }
+
+        std::vector<Item> sortedItems;
+        sortedItems.reserve(m_items.size());
+        for (const std::size_t index : order)
+            sortedItems.push_back(std::move(m_items[index]));
+
+        m_items = std::move(sortedItems);
+
+        // While the width of the widest item didn't change, its index might have, so we need to locate it again
+        updateWidestItem();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2856,6 +3340,10 @@ namespace tgui
         const float columnHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()
                                    - getCurrentHeaderHeight() - (m_horizontalScrollbar->isShown() ? m_horizontalScrollbar->getSize().y : 0);
 
+        // Virtual items are stored in a pool that only contains the visible items
+        const std::vector<Item>& items = m_virtualCellProvider ? m_virtualItemPool : m_items;
+        const std::size_t itemsOffset = m_virtualCellProvider ? m_virtualItemPoolStart : 0;
+
         // Draw the icons
         if ((column == 0) && (m_maxIconWidth > 0))
         {
@@ -2866,16 +3354,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = items[i - itemsOffset];
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2893,7 +3382,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = items[i - itemsOffset];
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2903,12 +3393,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == HorizontalAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == HorizontalAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == HorizontalAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2927,6 +3417,10 @@ namespace tgui
             m_possibleDoubleClick = false;
         }
 
+        // The main loop has to wake up to forget the first click, otherwise a much later click could count as double click
+        if (m_possibleDoubleClick && m_parentGui)
+            m_parentGui->scheduleUpdate(getDoubleClickTime() - m_animationTimeElapsed);
+
         return screenRefreshRequired;
     }
 
@@ -2952,14 +3446,15 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
-        std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
-        if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+        std::size_t firstItem;
+        std::size_t lastItem;
+        findVisibleItems(firstItem, lastItem);
+
+        // Only the virtual items in the pool can be drawn (which are all visible items unless the pool wasn't updated yet)
+        if (m_virtualCellProvider)
         {
-            firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
-            lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            lastItem = std::min(lastItem, m_virtualItemPoolStart + m_virtualItemPool.size());
+            firstItem = std::min(std::max(firstItem, m_virtualItemPoolStart), lastItem);
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -3006,7 +3501,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (getItemCount() > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
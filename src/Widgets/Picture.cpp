@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Backend/Window/BackendGui.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -228,6 +229,10 @@ namespace tgui
             m_possibleDoubleClick = false;
         }
 
+        // The main loop has to wake up to forget the first click, otherwise a much later click could count as double click
+        if (m_possibleDoubleClick && m_parentGui)
+            m_parentGui->scheduleUpdate(getDoubleClickTime() - m_animationTimeElapsed);
+
         return screenRefreshRequired;
     }
 
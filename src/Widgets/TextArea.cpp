@@ -27,6 +27,8 @@
 #include <TGUI/Keyboard.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <iterator>
     #include <cmath>
 #endif
 
@@ -34,6 +36,28 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Replaces the elements in the range [first, last) with the new elements. When the amount of elements stays the same,
+        // the elements behind the range don't have to be moved.
+        template <typename Container, typename T>
+        void replaceRange(Container& elements, std::size_t first, std::size_t last, std::vector<T>& newElements)
+        {
+            const std::size_t overlap = std::min(last - first, newElements.size());
+            const auto firstOffset = static_cast<std::ptrdiff_t>(first);
+            const auto overlapOffset = static_cast<std::ptrdiff_t>(overlap);
+            std::move(newElements.begin(), newElements.begin() + overlapOffset, elements.begin() + firstOffset);
+
+            if (newElements.size() < last - first)
+                elements.erase(elements.begin() + firstOffset + overlapOffset, elements.begin() + static_cast<std::ptrdiff_t>(last));
+            else if (newElements.size() > last - first)
+                elements.insert(elements.begin() + firstOffset + overlapOffset,
+                                std::make_move_iterator(newElements.begin() + overlapOffset), std::make_move_iterator(newElements.end()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char TextArea::StaticWidgetType[];
 #endif
@@ -139,23 +163,41 @@ namespace tgui
         else
             m_text = text.toUtf32();
 
+        m_textStart = 0;
         rearrangeText(false);
+        removeExcessLines();
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::addText(String text)
     {
-        setText(m_text + std::move(text));
+        // Don't allow the text to contain carriage returns
+        text.replace('\r', U"");
+
+        // Remove the characters that no longer fit when a character limit is set
+        if ((m_maxChars > 0) && (m_text.length() - m_textStart + text.length() > m_maxChars))
+            text.erase(m_maxChars - std::min(m_maxChars, m_text.length() - m_textStart));
+
+        // Only the part of the text that was added has to be word-wrapped
+        const std::size_t oldTextLength = m_text.length();
+        m_text.append(text);
+        rearrangeChangedText(oldTextLength, 0, text.length(), false);
+        removeExcessLines();
+
+        setCaretPosition(m_text.length() - m_textStart);
+
+        onTextAppend.emit(this, text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String TextArea::getText() const
     {
-        return m_text;
+        return m_text.substr(m_textStart);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,8 +230,8 @@ namespace tgui
 
     String TextArea::getSelectedText() const
     {
-        const std::size_t selStart = getSelectionStart();
-        const std::size_t selEnd = getSelectionEnd();
+        const std::size_t selStart = getIndexOfSelectionPos(m_selStart);
+        const std::size_t selEnd = getIndexOfSelectionPos(m_selEnd);
         if (selStart <= selEnd)
             return m_text.substr(selStart, selEnd - selStart);
         else
@@ -200,14 +242,14 @@ namespace tgui
 
     std::size_t TextArea::getSelectionStart() const
     {
-        return getIndexOfSelectionPos(m_selStart);
+        return getIndexOfSelectionPos(m_selStart) - m_textStart;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t TextArea::getSelectionEnd() const
     {
-        return getIndexOfSelectionPos(m_selEnd);
+        return getIndexOfSelectionPos(m_selEnd) - m_textStart;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,10 +284,10 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_text.length() > m_maxChars))
+        if ((m_maxChars > 0) && (m_text.length() - m_textStart > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, String::npos);
+            m_text.erase(m_textStart + m_maxChars, String::npos);
             rearrangeText(false);
         }
     }
@@ -259,6 +301,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::setMaximumLines(std::size_t maxLines)
+    {
+        m_maxLines = maxLines;
+        removeExcessLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextArea::getMaximumLines() const
+    {
+        return m_maxLines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::setTabString(String tabText)
     {
         // Do not allow evil cartridge returns.
@@ -356,7 +413,7 @@ namespace tgui
         if (caret == 0)
             return 1;
         else
-            return m_text.substr(0, caret).count('\n') + 1;
+            return m_text.substr(m_textStart, caret).count('\n') + 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,11 +423,11 @@ namespace tgui
         const auto caret = getCaretPosition();
         if (caret == 0)
             return 1;
-        auto lineStart = m_text.rfind('\n', caret - 1);
-        if (lineStart == String::npos)
+        auto lineStart = m_text.rfind('\n', m_textStart + caret - 1);
+        if ((lineStart == String::npos) || (lineStart < m_textStart))
             return caret + 1;
         else
-            return caret - lineStart;
+            return m_textStart + caret - lineStart;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -449,7 +506,12 @@ namespace tgui
 
     void TextArea::enableMonospacedFontOptimization(bool enable)
     {
+        if (m_monospacedFontOptimizationEnabled == enable)
+            return;
+
+        // The widths of the lines are only stored when the optimization is disabled
         m_monospacedFontOptimizationEnabled = enable;
+        rearrangeText(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -457,6 +519,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -821,27 +884,24 @@ namespace tgui
             return;
 
         // Make sure we don't exceed our maximum characters limit
-        if ((m_maxChars > 0) && (m_text.length() + 1 > m_maxChars))
+        if ((m_maxChars > 0) && (m_text.length() - m_textStart + 1 > m_maxChars))
             return;
 
         auto insert = TGUI_LAMBDA_CAPTURE_EQ_THIS()
         {
             deleteSelectedCharacters();
 
-            const std::size_t caretPosition = getSelectionEnd();
+            const std::size_t caretPosition = getIndexOfSelectionPos(m_selEnd);
 
             m_text.insert(caretPosition, 1, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, 1, key);
 
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != U'\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].empty() || (m_text[caretPosition-1] == U'\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
+            // Place the caret behind the inserted character. The selection is converted to a character index before the lines are
+            // updated, so typing a newline at the start of a line that only existed due to word wrapping won't move the caret.
+            m_selStart.x++;
+            m_selEnd.x++;
 
             // Do not emit onCaretPositionChanged signal yet, as it could be invalid.
-            rearrangeText(true, false);
+            rearrangeChangedText(caretPosition, 0, 1, false);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -856,6 +916,12 @@ namespace tgui
         {
             // Store the data so that it can be reverted
             const auto oldText = m_text;
+            const auto oldTextStart = m_textStart;
+            const auto oldLines = m_lines;
+            const auto oldLineStarts = m_lineStarts;
+            const auto oldLineWidths = m_lineWidths;
+            const auto oldLineStartsShift = m_lineStartsShift;
+            const auto oldLineStartsShiftBegin = m_lineStartsShiftBegin;
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
 
@@ -866,6 +932,12 @@ namespace tgui
             if (m_lines.size() > static_cast<std::size_t>(getInnerSize().y / m_lineHeight))
             {
                 m_text = oldText;
+                m_textStart = oldTextStart;
+                m_lines = oldLines;
+                m_lineStarts = oldLineStarts;
+                m_lineWidths = oldLineWidths;
+                m_lineStartsShift = oldLineStartsShift;
+                m_lineStartsShiftBegin = oldLineStartsShiftBegin;
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
 
@@ -878,11 +950,13 @@ namespace tgui
             }
         }
 
+        removeExcessLines();
+
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -976,20 +1050,33 @@ namespace tgui
 
     std::size_t TextArea::getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
+        if (selectionPos.y < m_lineStarts.size())
+            return getLineStart(selectionPos.y) + selectionPos.x;
+        else
+            return m_textStart + selectionPos.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2<std::size_t> TextArea::getSelectionPosOfIndex(std::size_t index) const
+    {
+        // Search the first line that ends at or behind the index. When the index is located at a position where word wrap split
+        // the text, the position at the end of the first line is returned.
+        std::size_t low = 0;
+        std::size_t high = m_lines.size();
+        while (low < high)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].length();
-                if ((counter < m_text.length()) && (m_text[counter] == U'\n'))
-                    counter += 1;
-            }
+            const std::size_t mid = low + ((high - low) / 2);
+            if (getLineStart(mid) + m_lines[mid].length() < index)
+                low = mid + 1;
+            else
+                high = mid;
+        }
 
-            return counter;
-        };
+        if (low == m_lines.size())
+            return {m_lines[m_lines.size()-1].length(), m_lines.size()-1};
 
-        return findIndex(selectionPos.y) + selectionPos.x;
+        return {index - getLineStart(low), low};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -998,20 +1085,20 @@ namespace tgui
     {
         if (m_selStart != m_selEnd)
         {
-            const std::size_t selStart = getSelectionStart();
-            const std::size_t selEnd = getSelectionEnd();
+            const std::size_t selStart = getIndexOfSelectionPos(m_selStart);
+            const std::size_t selEnd = getIndexOfSelectionPos(m_selEnd);
             if (selStart <= selEnd)
             {
                 m_text.erase(selStart, selEnd - selStart);
                 updateSelEnd(m_selStart);
+                rearrangeChangedText(selStart, selEnd - selStart, 0);
             }
             else
             {
                 m_text.erase(selEnd, selStart - selEnd);
                 m_selStart = m_selEnd;
+                rearrangeChangedText(selEnd, selStart - selEnd, 0);
             }
-
-            rearrangeText(true);
         }
     }
 
@@ -1023,7 +1110,7 @@ namespace tgui
             return;
 
         // If given string exceeds character limit, remove characters from the end until it fits.
-        const auto combinedSize = m_text.size() + text.size();
+        const auto combinedSize = m_text.size() - m_textStart + text.size();
         if (m_maxChars != 0 && combinedSize > m_maxChars)
             text = text.substr(0, text.size() - (combinedSize - m_maxChars));
 
@@ -1031,15 +1118,16 @@ namespace tgui
             return;
 
         // Insert string.
-        m_text.insert(getSelectionEnd(), text);
-        m_lines[m_selEnd.y].insert(m_selEnd.x, text);
+        const std::size_t caretPosition = getIndexOfSelectionPos(m_selEnd);
+        m_text.insert(caretPosition, text);
 
         m_selEnd.x += text.length();
         m_selStart = m_selEnd;
-        rearrangeText(true, false);
+        rearrangeChangedText(caretPosition, 0, text.length(), false);
         onCaretPositionChange.emit(this);
+        removeExcessLines();
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1262,15 +1350,15 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            const std::size_t pos = getSelectionEnd();
-            if (pos > 0)
+            const std::size_t pos = getIndexOfSelectionPos(m_selEnd);
+            if (pos > m_textStart)
             {
                 if (m_selEnd.x > 0)
                 {
                     // There is a specific case that we have to watch out for. When we are removing the last character on
                     // a line which was placed there by word wrap and a newline follows this character then the caret
                     // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                    if ((m_lines[m_selEnd.y].length() == 1) && (pos > 1) && (pos < m_text.length()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
+                    if ((m_lines[m_selEnd.y].length() == 1) && (pos > m_textStart + 1) && (pos < m_text.length()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
                     {
                         m_selEnd.y--;
                         m_selEnd.x = m_lines[m_selEnd.y].length();
@@ -1295,7 +1383,7 @@ namespace tgui
                 m_text.erase(pos - 1, 1);
                 // If the "special case" above passes, and we let rearrangeText() emit the onCaretPositionChange signal,
                 // the same signal will be emitted twice. So prevent sending signal in rearrangeText() and always send it manually afterwards.
-                rearrangeText(true, false);
+                rearrangeChangedText(pos - 1, 1, 0, false);
                 onCaretPositionChange.emit(this);
             }
         }
@@ -1306,7 +1394,7 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1319,21 +1407,25 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            const std::size_t pos = getIndexOfSelectionPos(m_selEnd);
+            if (pos < m_text.length())
+            {
+                m_text.erase(pos, 1);
+                rearrangeChangedText(pos, 1, 0);
+            }
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::copySelectedTextToClipboard()
     {
-        const std::size_t selStart = getSelectionStart();
-        const std::size_t selEnd = getSelectionEnd();
+        const std::size_t selStart = getIndexOfSelectionPos(m_selStart);
+        const std::size_t selEnd = getIndexOfSelectionPos(m_selEnd);
         if (selStart <= selEnd)
             getBackend()->setClipboard(m_text.substr(selStart, selEnd - selStart));
         else
@@ -1387,9 +1479,112 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
+        std::vector<String> lines;
+        std::vector<std::size_t> lineStarts;
+        std::vector<float> lineWidths;
+        if (!splitTextIntoLines(m_textStart, m_text.length(), lines, lineStarts, lineWidths))
+            return;
+
+        // Store the current selection position when we are keeping the selection
+        const std::size_t selStart = keepSelection ? getIndexOfSelectionPos(m_selStart) : m_text.length();
+        const std::size_t selEnd = keepSelection ? getIndexOfSelectionPos(m_selEnd) : m_text.length();
+
+        m_lines.assign(std::make_move_iterator(lines.begin()), std::make_move_iterator(lines.end()));
+        m_lineStarts.assign(lineStarts.begin(), lineStarts.end());
+        m_lineWidths.assign(lineWidths.begin(), lineWidths.end());
+        m_lineStartsShift = 0;
+        m_lineStartsShiftBegin = m_lineStarts.size();
+
+        recalculateMaxLineWidth();
+        finishRearrangingText(selStart, selEnd, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::rearrangeChangedText(std::size_t changeIndex, std::size_t removedCount, std::size_t insertedCount, bool emitCaretChangedPosition)
+    {
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
+        // If the lines didn't match the old text (e.g. because the text was changed before a font was set) then redo everything
+        const std::size_t oldTextLength = m_text.length() + removedCount - insertedCount;
+        if (m_lines.empty() || (getLineStart(m_lines.size() - 1) + m_lines.back().length() != oldTextLength))
+        {
+            rearrangeText(true, emitCaretChangedPosition);
+            return;
+        }
+
+        // Only the paragraphs that contain the changed characters need to be word-wrapped again.
+        // The characters before the change are still the same, so we can search the start of the paragraph in the new text.
+        std::size_t paragraphStart = m_textStart;
+        if (changeIndex > m_textStart)
+        {
+            const std::size_t newLinePos = m_text.rfind(U'\n', changeIndex - 1);
+            if ((newLinePos != String::npos) && (newLinePos >= m_textStart))
+                paragraphStart = newLinePos + 1;
+        }
+
+        std::size_t newParagraphEnd = m_text.find(U'\n', changeIndex + insertedCount);
+        if (newParagraphEnd == String::npos)
+            newParagraphEnd = m_text.length();
+
+        const std::size_t oldParagraphEnd = newParagraphEnd + removedCount - insertedCount;
+
+        // Find the lines that belong to the changed paragraphs in the old text
+        const auto findFirstLineBehind = [this](std::size_t index, std::size_t low){
+            std::size_t high = m_lineStarts.size();
+            while (low < high)
+            {
+                const std::size_t mid = low + ((high - low) / 2);
+                if (getLineStart(mid) <= index)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return low;
+        };
+        const std::size_t firstLine = findFirstLineBehind(paragraphStart, 0) - 1;
+        const std::size_t lastLine = findFirstLineBehind(oldParagraphEnd, firstLine);
+
+        std::vector<String> lines;
+        std::vector<std::size_t> lineStarts;
+        std::vector<float> lineWidths;
+        if (!splitTextIntoLines(paragraphStart, newParagraphEnd, lines, lineStarts, lineWidths))
+            return;
+
+        // Store the current selection position while the lines before the change still match the text
+        const std::size_t selStart = getIndexOfSelectionPos(m_selStart);
+        const std::size_t selEnd = getIndexOfSelectionPos(m_selEnd);
+
+        // The lines behind the changed paragraphs still have the same contents, but they are moved inside the text.
+        // Updating their start positions is postponed, only the lines between the previous change and this one are updated.
+        moveLineStartsShiftBegin(lastLine);
+        m_lineStartsShift = m_lineStartsShift + insertedCount - removedCount;
+
+        // Replace the old lines of the paragraphs
+        const bool widestLineReplaced = containsWidestLine(firstLine, lastLine);
+        const std::size_t newLineCount = lines.size();
+        replaceRange(m_lines, firstLine, lastLine, lines);
+        replaceRange(m_lineWidths, firstLine, lastLine, lineWidths);
+        replaceRange(m_lineStarts, firstLine, lastLine, lineStarts);
+        m_lineStartsShiftBegin = firstLine + newLineCount;
+
+        // The other lines only have to be measured again when the widest line was replaced by narrower lines
+        if (!updateMaxLineWidth(firstLine, firstLine + newLineCount) && widestLineReplaced)
+            recalculateMaxLineWidth();
+
+        finishRearrangingText(selStart, selEnd, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextArea::splitTextIntoLines(std::size_t startIndex, std::size_t endIndex, std::vector<String>& lines,
+                                      std::vector<std::size_t>& lineStarts, std::vector<float>& lineWidths) const
+    {
         String string;
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
+            string = m_text.substr(startIndex, endIndex - startIndex);
         else
         {
             // Find the maximum width of one line
@@ -1400,111 +1595,227 @@ namespace tgui
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
-                return;
+                return false;
 
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
+            string = Text::wordWrap(maxLineWidth, m_text.substr(startIndex, endIndex - startIndex), m_fontCached, m_textSizeCached, false);
         }
 
-        // Store the current selection position when we are keeping the selection
-        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
-        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
-
         // Split the string in multiple lines
-        m_maxLineWidth = 0;
-        m_lines.clear();
+        const bool measureLines = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
+        std::size_t index = startIndex;
         std::size_t searchPosStart = 0;
         std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
         while (newLinePos != String::npos)
         {
             newLinePos = string.find('\n', searchPosStart);
 
             if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
+                lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
             else
-                m_lines.push_back(string.substr(searchPosStart));
+                lines.push_back(string.substr(searchPosStart));
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
-            }
+            // Not using optimization for monospaced font, so really calculate the width of every line
+            if (measureLines)
+                lineWidths.push_back(Text::getLineWidth(lines.back(), m_fontCached, m_textSizeCached));
+            else
+                lineWidths.push_back(0);
+
+            // Word wrap only inserts newlines, so we can keep track of where the line is located in the original text
+            lineStarts.push_back(index);
+            index += lines.back().length();
+            if ((index < m_text.length()) && (m_text[index] == U'\n'))
+                ++index;
 
             searchPosStart = newLinePos + 1;
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::removeExcessLines()
+    {
+        if ((m_maxLines == 0) || (m_lines.size() <= m_maxLines))
+            return;
+
+        // Lines can only be removed when they match the current text
+        if (getLineStart(m_lines.size() - 1) + m_lines.back().length() != m_text.length())
+            return;
+
+        // The remaining lines start at the beginning of a line, so the word-wrap doesn't change by removing the lines above them
+        const std::size_t linesToRemove = m_lines.size() - m_maxLines;
+        const std::size_t newTextStart = getLineStart(linesToRemove);
+
+        std::size_t selStart = std::max(getIndexOfSelectionPos(m_selStart), newTextStart);
+        std::size_t selEnd = std::max(getIndexOfSelectionPos(m_selEnd), newTextStart);
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+        if (containsWidestLine(0, linesToRemove))
+            m_maxLineWidthOutdated = true;
+
+        if (m_lineStartsShiftBegin < linesToRemove)
+            moveLineStartsShiftBegin(linesToRemove);
+
+        const auto linesToRemoveOffset = static_cast<std::ptrdiff_t>(linesToRemove);
+        m_lines.erase(m_lines.begin(), m_lines.begin() + linesToRemoveOffset);
+        m_lineWidths.erase(m_lineWidths.begin(), m_lineWidths.begin() + linesToRemoveOffset);
+        m_lineStarts.erase(m_lineStarts.begin(), m_lineStarts.begin() + linesToRemoveOffset);
+        m_lineStartsShiftBegin -= linesToRemove;
+
+        // The removed characters are only erased once there are more of them than characters that remain, so that moving the
+        // remaining text and updating the line starts happens less often as more lines are kept.
+        m_textStart = newTextStart;
+        if (m_textStart > m_text.length() - m_textStart)
         {
-            std::size_t index = 0;
-            Vector2<std::size_t> newSelStart;
-            Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            m_text.erase(0, m_textStart);
+            moveLineStartsShiftBegin(0);
+            m_lineStartsShift -= m_textStart;
+            selStart -= m_textStart;
+            selEnd -= m_textStart;
+            m_textStart = 0;
+        }
+
+        // Searching the widest line again is postponed until a quarter of the lines have been replaced since the last search
+        m_linesRemovedSinceMaxLineWidth += linesToRemove;
+        if (m_maxLineWidthOutdated && (m_linesRemovedSinceMaxLineWidth >= m_maxLines / 4))
+            recalculateMaxLineWidth();
+
+        finishRearrangingText(selStart, selEnd, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::emitTextChange()
+    {
+        if (!onTextChange.hasHandlers())
+            return;
+
+        if (m_textStart == 0)
+            onTextChange.emit(this, m_text);
+        else
+            onTextChange.emit(this, getText());
+    }
 
-            // Look for the new locations of our selection
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextArea::getLineStart(std::size_t lineIndex) const
+    {
+        if (lineIndex >= m_lineStartsShiftBegin)
+            return m_lineStarts[lineIndex] + m_lineStartsShift;
+        else
+            return m_lineStarts[lineIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::moveLineStartsShiftBegin(std::size_t lineIndex)
+    {
+        if (m_lineStartsShift != 0)
+        {
+            // Lines that are no longer behind the boundary get their final position, lines that are now behind it are given
+            // the position that they had before the shift.
+            for (std::size_t i = m_lineStartsShiftBegin; i < lineIndex; ++i)
+                m_lineStarts[i] += m_lineStartsShift;
+            for (std::size_t i = lineIndex; i < m_lineStartsShiftBegin; ++i)
+                m_lineStarts[i] -= m_lineStartsShift;
+        }
+
+        m_lineStartsShiftBegin = lineIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::recalculateMaxLineWidth()
+    {
+        m_maxLineWidth = 0;
+        m_maxLineLength = 0;
+        m_maxLineWidthOutdated = false;
+        m_linesRemovedSinceMaxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
+            return;
+
+        if (m_monospacedFontOptimizationEnabled)
+        {
+            std::size_t longestLineIndex = 0;
             for (std::size_t i = 0; i < m_lines.size(); ++i)
             {
-                index += m_lines[i].length();
-
-                if (!newSelStartFound && (index >= selStart))
+                if (m_lines[i].length() > m_maxLineLength)
                 {
-                    newSelStart = Vector2<std::size_t>(m_lines[i].length() - (index - selStart), i);
-
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
+                    m_maxLineLength = m_lines[i].length();
+                    longestLineIndex = i;
                 }
+            }
 
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = Vector2<std::size_t>(m_lines[i].length() - (index - selEnd), i);
+            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        }
+        else
+            m_maxLineWidth = *std::max_element(m_lineWidths.begin(), m_lineWidths.end());
+    }
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Skip newlines in the text
-                if (m_text[index] == U'\n')
-                    ++index;
-            }
+    bool TextArea::updateMaxLineWidth(std::size_t firstLine, std::size_t lastLine)
+    {
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
+            return true;
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+        bool widestLineFound = false;
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            if (m_monospacedFontOptimizationEnabled)
             {
-                m_selStart = newSelStart;
-                if (emitCaretChangedPosition)
-                    updateSelEnd(newSelEnd);
-                else
-                    m_selEnd = newSelEnd;
+                if (m_lines[i].length() > m_maxLineLength)
+                {
+                    m_maxLineLength = m_lines[i].length();
+                    m_maxLineWidth = Text::getLineWidth(m_lines[i], m_fontCached, m_textSizeCached);
+                }
+
+                if (m_lines[i].length() == m_maxLineLength)
+                    widestLineFound = true;
             }
-            else // The text has changed too much, the selection can't be kept
+            else
             {
-                m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-                if (emitCaretChangedPosition)
-                    updateSelEnd(m_selStart);
-                else
-                    m_selEnd = m_selStart;
+                if (m_lineWidths[i] >= m_maxLineWidth)
+                {
+                    m_maxLineWidth = m_lineWidths[i];
+                    widestLineFound = true;
+                }
             }
         }
-        else // Set the caret at the back of the text
+
+        return widestLineFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextArea::containsWidestLine(std::size_t firstLine, std::size_t lastLine) const
+    {
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
+            return false;
+
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            if (m_monospacedFontOptimizationEnabled ? (m_lines[i].length() >= m_maxLineLength) : (m_lineWidths[i] >= m_maxLineWidth))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::finishRearrangingText(std::size_t selStart, std::size_t selEnd, bool emitCaretChangedPosition)
+    {
+        // Keep the selection when possible
+        if ((selStart <= m_text.length()) && (selEnd <= m_text.length()))
+        {
+            m_selStart = getSelectionPosOfIndex(selStart);
+            if (emitCaretChangedPosition)
+                updateSelEnd(getSelectionPosOfIndex(selEnd));
+            else
+                m_selEnd = getSelectionPosOfIndex(selEnd);
+        }
+        else // The text has changed too much, the selection can't be kept
         {
             m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
             if (emitCaretChangedPosition)
@@ -1577,71 +1888,6 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1691,6 +1937,7 @@ namespace tgui
             }
         }
 
+        updateDisplayedTexts();
         recalculatePositions();
 
         // Send an event when the selection changed
@@ -1707,6 +1954,90 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::updateDisplayedTexts()
+    {
+        // Only the lines around the visible area are placed in the texts, with a margin of a page above and below them so that
+        // the texts don't have to be updated again while scrolling a few lines.
+        const std::size_t topLine = m_verticalScrollbar->isShown() ? static_cast<std::size_t>(m_verticalScrollbar->getValue() / m_lineHeight) : 0;
+        const std::size_t pageLines = static_cast<std::size_t>(getInnerSize().y / m_lineHeight) + 2;
+        m_displayedLinesStart = (topLine > pageLines) ? (topLine - pageLines) : 0;
+        m_displayedLinesEnd = std::min(m_lines.size(), topLine + (2 * pageLines));
+        if (m_displayedLinesStart > m_displayedLinesEnd)
+            m_displayedLinesStart = m_displayedLinesEnd;
+
+        // Concatenates the lines within the displayed range
+        const auto joinLines = [this](std::size_t first, std::size_t last){
+            String string;
+            for (std::size_t i = std::max(first, m_displayedLinesStart); i < std::min(last, m_displayedLinesEnd); ++i)
+                string += m_lines[i] + U"\n";
+            return string;
+        };
+        const auto isLineDisplayed = [this](std::size_t line){
+            return (line >= m_displayedLinesStart) && (line < m_displayedLinesEnd);
+        };
+
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(joinLines(0, m_lines.size()));
+            m_textSelection1.setString(U"");
+            m_textSelection2.setString(U"");
+            m_textAfterSelection1.setString(U"");
+            m_textAfterSelection2.setString(U"");
+        }
+        else // Some text is selected
+        {
+            auto selectionStart = m_selStart;
+            auto selectionEnd = m_selEnd;
+
+            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+                std::swap(selectionStart, selectionEnd);
+
+            // Set the text before the selection
+            {
+                String string = joinLines(0, selectionStart.y);
+                if (isLineDisplayed(selectionStart.y))
+                    string += m_lines[selectionStart.y].substr(0, selectionStart.x);
+
+                m_textBeforeSelection.setString(string);
+            }
+
+            // Set the selected text
+            if (m_selStart.y == m_selEnd.y)
+            {
+                if (isLineDisplayed(selectionStart.y))
+                    m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
+                else
+                    m_textSelection1.setString(U"");
+
+                m_textSelection2.setString(U"");
+            }
+            else
+            {
+                if (isLineDisplayed(selectionStart.y))
+                    m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
+                else
+                    m_textSelection1.setString(U"");
+
+                String string = joinLines(selectionStart.y + 1, selectionEnd.y);
+                if (isLineDisplayed(selectionEnd.y))
+                    string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
+
+                m_textSelection2.setString(string);
+            }
+
+            // Set the text after the selection
+            if (isLineDisplayed(selectionEnd.y))
+                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
+            else
+                m_textAfterSelection1.setString(U"");
+
+            m_textAfterSelection2.setString(joinLines(selectionEnd.y + 1, m_lines.size()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f TextArea::getInnerSize() const
     {
         return {std::max(0.f, getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight()),
@@ -1731,9 +2062,15 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
 
-            screenRefreshRequired = true;
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                screenRefreshRequired = true;
         }
 
+        // Make sure the main loop wakes up again when the caret has to blink
+        if (m_focused && m_parentGui)
+            m_parentGui->scheduleUpdate(getEditCursorBlinkRate() - m_animationTimeElapsed);
+
         return screenRefreshRequired;
     }
 
@@ -1748,7 +2085,7 @@ namespace tgui
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_displayedLinesStart) * m_lineHeight});
         m_defaultText.setPosition({textOffset, 0});
 
         if (m_selStart != m_selEnd)
@@ -1767,69 +2104,73 @@ namespace tgui
             if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
                 kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
 
+            // The texts don't necessarily contain the lines on which the selection starts or ends, so the widths are
+            // calculated directly from the lines.
+            /// TODO: Implement a way to calculate text size without creating a text object?
+            Text tempText;
+            tempText.setFont(m_fontCached);
+            tempText.setCharacterSize(getTextSize());
+            const auto getTextWidth = [&tempText](const String& str){
+                if (str.empty())
+                    return 0.f;
+
+                tempText.setString(str);
+                return tempText.findCharacterPos(str.length()).x;
+            };
+
+            const bool selectionOnSingleLine = (selectionStart.y == selectionEnd.y);
+            const String& selectionStartLine = m_lines[selectionStart.y];
+            const float selectionStartLineWidth = selectionOnSingleLine
+                ? getTextWidth(selectionStartLine.substr(selectionStart.x, selectionEnd.x - selectionStart.x))
+                : getTextWidth(selectionStartLine.substr(selectionStart.x));
+
             if (selectionStart.x > 0)
             {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({textOffset + getTextWidth(selectionStartLine.substr(0, selectionStart.x)) + kerningSelectionStart,
+                                              static_cast<float>(selectionStart.y) * m_lineHeight});
             }
             else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y) * m_lineHeight});
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+            m_textSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionStart.y + 1, m_displayedLinesStart)) * m_lineHeight});
 
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
+            const float selectionEndLineWidth = getTextWidth(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
+            if (!selectionOnSingleLine)
             {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+                m_textAfterSelection1.setPosition({textOffset + selectionEndLineWidth + kerningSelectionEnd,
+                                                   static_cast<float>(selectionEnd.y) * m_lineHeight});
             }
             else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
+                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + selectionStartLineWidth + kerningSelectionEnd,
                                                    m_textSelection1.getPosition().y});
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
+            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionEnd.y + 1, m_displayedLinesStart)) * m_lineHeight});
 
-            // Recalculate the selection rectangles
+            // Recalculate the selection rectangles, only for the lines that are being displayed
+            const std::size_t firstRectLine = std::max(selectionStart.y, m_displayedLinesStart);
+            const std::size_t lastRectLine = std::min(selectionEnd.y + 1, m_displayedLinesEnd);
+            for (std::size_t i = firstRectLine; i < lastRectLine; ++i)
             {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
-
-                if (!m_lines[selectionStart.y].empty())
+                if (i == selectionStart.y)
                 {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
-
-                    if (!m_lines[i].empty())
+                    m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(i) * m_lineHeight, 0.f, m_lineHeight);
+                    if (!selectionStartLine.empty())
                     {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
+                        m_selectionRects.back().width = selectionStartLineWidth;
+
+                        // There is kerning when the selection is on just this line
+                        if (selectionOnSingleLine)
+                            m_selectionRects.back().width += kerningSelectionEnd;
                     }
                 }
+                else if (i == selectionEnd.y)
+                    m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, textOffset + selectionEndLineWidth + kerningSelectionEnd, m_lineHeight);
+                else
+                    m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, textOffset + getTextWidth(m_lines[i]), m_lineHeight);
 
-                if (selectionStart.y != selectionEnd.y)
-                {
+                // The selection continues on the next line
+                if (i < selectionEnd.y)
                     m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
             }
         }
 
@@ -1879,6 +2220,13 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        // Fill the texts with other lines if we scrolled outside the range of lines that they contain
+        if ((m_topLine < m_displayedLinesStart) || (std::min(m_topLine + m_visibleLines, m_lines.size()) > m_displayedLinesEnd))
+        {
+            updateDisplayedTexts();
+            recalculatePositions();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1887,6 +2235,8 @@ namespace tgui
     {
         if (signalName == onTextChange.getName())
             return onTextChange;
+        else if (signalName == onTextAppend.getName())
+            return onTextAppend;
         else if (signalName == onSelectionChange.getName())
             return onSelectionChange;
         else if (signalName == onCaretPositionChange.getName())
@@ -2003,10 +2353,12 @@ namespace tgui
     std::unique_ptr<DataIO::Node> TextArea::save(SavingRenderersMap& renderers) const
     {
         auto node = Widget::save(renderers);
-        node->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_text));
+        node->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(getText()));
         if (!getDefaultText().empty())
             node->propertyValuePairs[U"DefaultText"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(getDefaultText()));
         node->propertyValuePairs[U"MaximumCharacters"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_maxChars));
+        if (m_maxLines > 0)
+            node->propertyValuePairs[U"MaximumLines"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_maxLines));
 
         if (m_readOnly)
             node->propertyValuePairs[U"ReadOnly"] = std::make_unique<DataIO::ValueNode>("true");
@@ -2041,6 +2393,8 @@ namespace tgui
             setDefaultText(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"DefaultText"]->value).getString());
         if (node->propertyValuePairs[U"MaximumCharacters"])
             setMaximumCharacters(node->propertyValuePairs[U"MaximumCharacters"]->value.toUInt());
+        if (node->propertyValuePairs[U"MaximumLines"])
+            setMaximumLines(node->propertyValuePairs[U"MaximumLines"]->value.toUInt());
         if (node->propertyValuePairs[U"ReadOnly"])
             setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs[U"ReadOnly"]->value).getBool());
 
@@ -2117,7 +2471,7 @@ namespace tgui
             }
 
             // Draw the text
-            if (m_text.empty())
+            if (m_text.length() == m_textStart)
                 target.drawText(states, m_defaultText);
             else
             {
@@ -2155,35 +2509,22 @@ namespace tgui
     void TextArea::setCaretPositionImpl(std::size_t charactersBeforeCaret, bool selEndNeedUpdate, bool emitCaretChangedPosition)
     {
         // The caret position has to stay inside the string
-        if (charactersBeforeCaret > m_text.length())
-            charactersBeforeCaret = m_text.length();
+        if (charactersBeforeCaret > m_text.length() - m_textStart)
+            charactersBeforeCaret = m_text.length() - m_textStart;
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
+        if (m_lines.empty())
+            return;
+
+        m_selStart = getSelectionPosOfIndex(m_textStart + charactersBeforeCaret);
+        if (selEndNeedUpdate)
         {
-            if (count + m_lines[i].length() < charactersBeforeCaret)
-            {
-                count += m_lines[i].length();
-                if ((count < m_text.length()) && (m_text[count] == U'\n'))
-                    count += 1;
-            }
+            if (emitCaretChangedPosition)
+                updateSelEnd(m_selStart);
             else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                if (selEndNeedUpdate)
-                {
-                    if (emitCaretChangedPosition)
-                        updateSelEnd(m_selStart);
-                    else
-                        m_selEnd = m_selStart;
-                }
-                updateSelectionTexts();
-                break;
-            }
+                m_selEnd = m_selStart;
         }
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
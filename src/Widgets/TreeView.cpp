@@ -24,6 +24,7 @@
 
 #include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Keyboard.hpp>
+#include <TGUI/Backend/Window/BackendGui.hpp>
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -1214,6 +1215,10 @@ namespace tgui
             m_possibleDoubleClick = false;
         }
 
+        // The main loop has to wake up to forget the first click, otherwise a much later click could count as double click
+        if (m_possibleDoubleClick && m_parentGui)
+            m_parentGui->scheduleUpdate(getDoubleClickTime() - m_animationTimeElapsed);
+
         return screenRefreshRequired;
     }
 
@@ -41,6 +41,8 @@
     #include <raylib.h>
 #endif
 
+#include <thread>
+
 #include "Tests.hpp"
 
 #if TGUI_BUILD_AS_CXX_MODULE
@@ -2070,4 +2072,213 @@ TEST_CASE("[Backend events]")
         }
     }
 #endif
+
+    SECTION("Mouse move coalescing")
+    {
+        auto gui = std::make_shared<GuiNull>();
+        auto button = tgui::Button::create();
+        button->setPosition({50, 50});
+        button->setSize({50, 50});
+        gui->add(button);
+
+        unsigned int mouseEnteredCount = 0;
+        unsigned int clickedCount = 0;
+        button->onMouseEnter([&]{ ++mouseEnteredCount; });
+        button->onClick([&]{ ++clickedCount; });
+
+        const auto createMouseEvent = [](tgui::Event::Type type, int x, int y){
+            tgui::Event event;
+            event.type = type;
+            if (type == tgui::Event::Type::MouseMoved)
+            {
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+            }
+            else
+            {
+                event.mouseButton.button = tgui::Event::MouseButton::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+            }
+            return event;
+        };
+
+        REQUIRE(!gui->isMouseMoveCoalescingEnabled());
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 10, 10));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 60, 60));
+        REQUIRE(gui->getDispatchedMouseMoveCount() == 2);
+        REQUIRE(gui->getCoalescedMouseMoveCount() == 0);
+        REQUIRE(mouseEnteredCount == 1);
+
+        gui->setMouseMoveCoalescingEnabled(true);
+        REQUIRE(gui->isMouseMoveCoalescingEnabled());
+
+        // Only the last position is passed to the widgets
+        REQUIRE(!gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 10, 10)));
+        REQUIRE(!gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 20, 20)));
+        REQUIRE(!gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 70, 70)));
+        REQUIRE(gui->getDispatchedMouseMoveCount() == 2);
+        REQUIRE(gui->flushPendingMouseMove());
+        REQUIRE(!gui->flushPendingMouseMove());
+        REQUIRE(gui->getDispatchedMouseMoveCount() == 3);
+        REQUIRE(gui->getCoalescedMouseMoveCount() == 2);
+        REQUIRE(mouseEnteredCount == 1);
+
+        // A pending mouse move is handled before other events, so the mouse press happens outside the button
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 80, 80));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 10, 10));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseButtonPressed, 10, 10));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 60, 60));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseButtonReleased, 60, 60));
+        REQUIRE(gui->getDispatchedMouseMoveCount() == 5);
+        REQUIRE(gui->getCoalescedMouseMoveCount() == 3);
+        REQUIRE(mouseEnteredCount == 2);
+        REQUIRE(clickedCount == 0);
+
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseButtonPressed, 60, 60));
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseButtonReleased, 60, 60));
+        REQUIRE(clickedCount == 1);
+
+        // Disabling the coalescing handles the pending event
+        gui->handleEvent(createMouseEvent(tgui::Event::Type::MouseMoved, 10, 10));
+        gui->setMouseMoveCoalescingEnabled(false);
+        REQUIRE(gui->getDispatchedMouseMoveCount() == 6);
+    }
+
+    SECTION("Posted tasks")
+    {
+        auto gui = std::make_shared<GuiNull>();
+        REQUIRE(!gui->runPostedTasks());
+
+        std::vector<int> executedTasks;
+        gui->post([&]{ executedTasks.push_back(0); });
+        std::thread worker([&]{
+            for (int i = 1; i < 100; ++i)
+                gui->post([&executedTasks,i]{ executedTasks.push_back(i); });
+        });
+        worker.join();
+
+        // Tasks are only executed on the gui thread, in the order in which they were posted
+        REQUIRE(executedTasks.empty());
+        REQUIRE(gui->runPostedTasks());
+        REQUIRE(executedTasks.size() == 100);
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(executedTasks[static_cast<std::size_t>(i)] == i);
+
+        REQUIRE(!gui->runPostedTasks());
+
+        // A task that posts another task only has it executed the next time
+        gui->post([&]{ gui->post([&]{ executedTasks.push_back(100); }); });
+        REQUIRE(gui->updateTime());
+        REQUIRE(executedTasks.size() == 100);
+        REQUIRE(gui->updateTime());
+        REQUIRE(executedTasks.size() == 101);
+
+        // Waiting stops as soon as a task is posted
+        const auto startTime = std::chrono::steady_clock::now();
+        std::thread delayedWorker([&]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            gui->post([&]{ executedTasks.push_back(101); });
+        });
+        gui->waitForPostedTasks(std::chrono::seconds(60));
+        delayedWorker.join();
+        REQUIRE(std::chrono::steady_clock::now() - startTime < std::chrono::seconds(30));
+        REQUIRE(gui->runPostedTasks());
+        REQUIRE(executedTasks.size() == 102);
+
+        // Tasks that are never executed are destroyed together with the gui
+        gui->post([]{});
+    }
+
+    SECTION("Scheduled updates")
+    {
+        auto gui = std::make_shared<GuiNull>();
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+
+        gui->scheduleUpdate(std::chrono::milliseconds(500));
+        gui->scheduleUpdate(std::chrono::seconds(5));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        REQUIRE(*gui->getTimeUntilNextUpdate() <= std::chrono::milliseconds(500));
+        REQUIRE(*gui->getTimeUntilNextUpdate() > std::chrono::milliseconds(250));
+
+        // Requests are forgotten when the time is updated
+        gui->updateTime(std::chrono::milliseconds(1));
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+
+        // A focused edit box needs to wake up the gui to let the caret blink
+        auto editBox = tgui::EditBox::create();
+        gui->add(editBox);
+        editBox->setFocused(true);
+        gui->updateTime(std::chrono::milliseconds(1));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        REQUIRE(*gui->getTimeUntilNextUpdate() <= tgui::getEditCursorBlinkRate());
+
+        editBox->setFocused(false);
+        gui->updateTime(std::chrono::milliseconds(1));
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+
+        // Timers also determine when the gui has to be updated
+        auto timer = tgui::Timer::create([]{}, std::chrono::milliseconds(300));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        REQUIRE(*gui->getTimeUntilNextUpdate() <= std::chrono::milliseconds(300));
+        timer->setEnabled(false);
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+
+        // The gui has to keep being updated while a widget is being animated
+        auto button = tgui::Button::create();
+        gui->add(button);
+        button->showWithEffect(tgui::ShowEffectType::Fade, std::chrono::milliseconds(300));
+        gui->updateTime(std::chrono::milliseconds(1));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        REQUIRE(*gui->getTimeUntilNextUpdate() <= std::chrono::milliseconds(15));
+        gui->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        gui->updateTime(std::chrono::milliseconds(300));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        gui->updateTime(std::chrono::milliseconds(15));
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+
+        // Widgets that report a change in updateTime keep getting updated without having to schedule updates themselves
+        class AnimatedWidget : public tgui::ClickableWidget
+        {
+        public:
+            bool updateTime(tgui::Duration elapsedTime) override
+            {
+                tgui::ClickableWidget::updateTime(elapsedTime);
+                ++ticks;
+                return animating;
+            }
+
+            unsigned int ticks = 0;
+            bool animating = true;
+        };
+
+        auto animatedWidget = std::make_shared<AnimatedWidget>();
+        gui->add(animatedWidget);
+        for (unsigned int i = 1; i <= 5; ++i)
+        {
+            gui->updateTime(std::chrono::milliseconds(15));
+            REQUIRE(animatedWidget->ticks == i);
+            REQUIRE(gui->getTimeUntilNextUpdate());
+            REQUIRE(*gui->getTimeUntilNextUpdate() <= std::chrono::milliseconds(15));
+        }
+
+        animatedWidget->animating = false;
+        gui->updateTime(std::chrono::milliseconds(15));
+        REQUIRE(animatedWidget->ticks == 6);
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+        gui->remove(animatedWidget);
+
+        // After clicking, the gui has to wake up to forget the click when the double click time has passed
+        auto picture = tgui::Picture::create();
+        picture->setSize({50, 50});
+        gui->add(picture);
+        picture->leftMousePressed({10, 10});
+        picture->leftMouseReleased({10, 10});
+        gui->updateTime(std::chrono::milliseconds(1));
+        REQUIRE(gui->getTimeUntilNextUpdate());
+        REQUIRE(*gui->getTimeUntilNextUpdate() <= tgui::getDoubleClickTime());
+        gui->updateTime(tgui::getDoubleClickTime());
+        REQUIRE(!gui->getTimeUntilNextUpdate());
+    }
 }
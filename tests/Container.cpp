@@ -443,5 +443,74 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}, false) == w2);
     }
 
+    SECTION("Spatial index")
+    {
+        auto panel = tgui::Panel::create({400, 400});
+        REQUIRE(!panel->isSpatialIndexEnabled());
+
+        for (unsigned int y = 0; y < 20; ++y)
+        {
+            for (unsigned int x = 0; x < 20; ++x)
+            {
+                auto widget = tgui::ClickableWidget::create({10, 10});
+                widget->setPosition({x * 15.f, y * 15.f});
+                panel->add(widget);
+            }
+        }
+
+        auto bigWidget = tgui::ClickableWidget::create({100, 40});
+        bigWidget->setPosition({30, 30});
+        panel->add(bigWidget);
+
+        auto rotatedWidget = tgui::ClickableWidget::create({20, 20});
+        rotatedWidget->setPosition({200, 200});
+        rotatedWidget->setRotation(45);
+        panel->add(rotatedWidget);
+
+        std::vector<tgui::Widget::Ptr> expectedWidgets;
+        for (float y = 0; y < 320; y += 3.5f)
+        {
+            for (float x = 0; x < 320; x += 3.5f)
+                expectedWidgets.push_back(panel->getWidgetAtPos({x, y}, false));
+        }
+
+        panel->setSpatialIndexEnabled(true);
+        REQUIRE(panel->isSpatialIndexEnabled());
+
+        std::size_t i = 0;
+        for (float y = 0; y < 320; y += 3.5f)
+        {
+            for (float x = 0; x < 320; x += 3.5f)
+            {
+                if (panel->getWidgetAtPos({x, y}, false) != expectedWidgets[i++])
+                    FAIL("Wrong widget found at (" << x << ", " << y << ")");
+            }
+        }
+
+        REQUIRE(panel->getWidgetAtPos({42, 42}, false) == bigWidget);
+        REQUIRE(panel->getWidgetAtPos({200, 212}, false) == rotatedWidget);
+
+        // The index is updated when widgets are moved, resized, hidden or reordered
+        bigWidget->setPosition({500, 500});
+        REQUIRE(panel->getWidgetAtPos({42, 42}, false) == nullptr);
+        REQUIRE(panel->getWidgetAtPos({505, 505}, false) == bigWidget);
+
+        bigWidget->setSize({10, 10});
+        REQUIRE(panel->getWidgetAtPos({515, 515}, false) == nullptr);
+
+        panel->moveWidgetToBack(bigWidget);
+        bigWidget->setPosition({0, 0});
+        REQUIRE(panel->getWidgetAtPos({5, 5}, false) == panel->getWidgets()[1]);
+
+        panel->getWidgets()[1]->setVisible(false);
+        REQUIRE(panel->getWidgetAtPos({5, 5}, false) == bigWidget);
+
+        panel->remove(bigWidget);
+        REQUIRE(panel->getWidgetAtPos({5, 5}, false) == nullptr);
+
+        panel->setSpatialIndexEnabled(false);
+        REQUIRE(panel->getWidgetAtPos({20, 5}, false) == panel->getWidgets()[1]);
+    }
+
     // TODO: Events
 }
@@ -24,6 +24,39 @@
 
 #include "Tests.hpp"
 
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+
+    class BackendFontFreetypeTest : public tgui::BackendFontFreetype
+    {
+    public:
+        bool hasGlyphsOfSize(unsigned int characterSize) const
+        {
+            for (const auto& texturePage : m_texturePages)
+            {
+                for (const auto& row : texturePage.rows)
+                {
+                    if (row.characterSize == characterSize)
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        std::vector<std::uint8_t> getGlyphPixels(const tgui::FontGlyph& glyph) const
+        {
+            const TexturePage& texturePage = m_texturePages[glyph.texturePage];
+            std::vector<std::uint8_t> pixels;
+            for (unsigned int y = glyph.textureRect.top; y < glyph.textureRect.top + glyph.textureRect.height; ++y)
+            {
+                const std::size_t rowStart = (static_cast<std::size_t>(y) * texturePage.size + glyph.textureRect.left) * m_bytesPerPixel;
+                pixels.insert(pixels.end(), &texturePage.pixels[rowStart], &texturePage.pixels[rowStart + glyph.textureRect.width * m_bytesPerPixel]);
+            }
+            return pixels;
+        }
+    };
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -37,4 +70,100 @@ TEST_CASE("[Font]")
     REQUIRE(!font.isSmooth());
     font.setSmooth(true);
     REQUIRE(font.isSmooth());
+
+    SECTION("Kerning")
+    {
+        // Values are cached, so requesting them again should give the same result
+        const float kerning = font.getKerning(U'A', U'V', 30, false);
+        REQUIRE(kerning <= 0);
+        REQUIRE(font.getKerning(U'A', U'V', 30, false) == kerning);
+        REQUIRE(font.getKerning(U'A', U'V', 30, true) <= 0);
+        REQUIRE(font.getKerning(U'A', 0, 30, false) == 0);
+
+        // Pairs outside the ASCII range are cached separately
+        const float kerningLatin1 = font.getKerning(U'\u00C0', U'V', 30, false);
+        REQUIRE(kerningLatin1 <= 0);
+        REQUIRE(font.getKerning(U'\u00C0', U'V', 30, false) == kerningLatin1);
+        REQUIRE(font.getKerning(U'A', U'V', 30, false) == kerning);
+
+        const float advance = font.getGlyph(U'A', 30, false).advance;
+        REQUIRE(advance > 0);
+        REQUIRE(font.getGlyph(U'A', 30, false).advance == advance);
+        REQUIRE(font.getGlyph(U'\u00C9', 30, false).advance > 0);
+    }
+
+    SECTION("Texture pages")
+    {
+        auto backendFont = font.getBackendFont();
+        for (unsigned int characterSize = 10; characterSize <= 100; characterSize += 30)
+        {
+            for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+            {
+                const tgui::FontGlyph glyph = font.getGlyph(codePoint, characterSize, false);
+                REQUIRE(glyph.texturePage < backendFont->getTexturePageCount(characterSize));
+            }
+        }
+
+        unsigned int textureVersion;
+        const unsigned int pageCount = backendFont->getTexturePageCount(20);
+        REQUIRE(pageCount >= 1);
+        for (unsigned int page = 0; page < pageCount; ++page)
+        {
+            REQUIRE(backendFont->getTexturePage(page, 20, textureVersion) != nullptr);
+            REQUIRE(backendFont->getTexturePageSize(page, 20).x > 0);
+        }
+    }
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    SECTION("Texture page eviction")
+    {
+        auto backendFont = std::make_shared<BackendFontFreetypeTest>();
+        REQUIRE(backendFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(backendFont->getMaximumTexturePageSize() == 2048);
+        REQUIRE(backendFont->getMaximumTexturePageCount() == 4);
+        backendFont->setMaximumTexturePageSize(128);
+        backendFont->setMaximumTexturePageCount(2);
+
+        const auto loadGlyphs = [&](unsigned int characterSize){
+            for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+                (void)backendFont->getGlyph(codePoint, characterSize, false);
+        };
+
+        tgui::getBackend()->startFrame();
+        const tgui::FontGlyph glyphBefore = backendFont->getGlyph(U'G', 20, false);
+        const std::vector<std::uint8_t> pixelsBefore = backendFont->getGlyphPixels(glyphBefore);
+        loadGlyphs(20);
+
+        // Each size is used in a different frame, so the glyphs of the oldest size are removed once both pages are full
+        for (const unsigned int characterSize : {24u, 28u, 32u})
+        {
+            tgui::getBackend()->startFrame();
+            loadGlyphs(characterSize);
+        }
+        REQUIRE(backendFont->getTexturePageCount(20) == 2);
+        REQUIRE(!backendFont->hasGlyphsOfSize(20));
+        REQUIRE(backendFont->hasGlyphsOfSize(32));
+
+        // Glyphs that are used in the current frame are never removed, even if this means exceeding the page limit
+        tgui::getBackend()->startFrame();
+        for (const unsigned int characterSize : {40u, 44u, 48u})
+            loadGlyphs(characterSize);
+        REQUIRE(backendFont->getTexturePageCount(20) > 2);
+        for (unsigned int page = 0; page < backendFont->getTexturePageCount(20); ++page)
+            REQUIRE(backendFont->getTexturePageSize(page, 20) == tgui::Vector2u{128, 128}); // Pages never grow
+        REQUIRE(backendFont->hasGlyphsOfSize(40));
+        REQUIRE(backendFont->hasGlyphsOfSize(44));
+        REQUIRE(backendFont->hasGlyphsOfSize(48));
+
+        // The evicted glyphs are rasterized again when needed
+        tgui::getBackend()->startFrame();
+        const tgui::FontGlyph glyphAfter = backendFont->getGlyph(U'G', 20, false);
+        REQUIRE(backendFont->hasGlyphsOfSize(20));
+        REQUIRE(glyphAfter.advance == glyphBefore.advance);
+        REQUIRE(glyphAfter.bounds == glyphBefore.bounds);
+        REQUIRE(glyphAfter.textureRect.width == glyphBefore.textureRect.width);
+        REQUIRE(glyphAfter.textureRect.height == glyphBefore.textureRect.height);
+        REQUIRE(backendFont->getGlyphPixels(glyphAfter) == pixelsBefore);
+    }
+#endif
 }
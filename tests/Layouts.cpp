@@ -466,6 +466,28 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Same expression in multiple widgets")
+        {
+            // The second layout is copied from the parsed expression of the first one, it may not share its bindings
+            auto panel1 = tgui::Panel::create({300, 200});
+            auto panel2 = tgui::Panel::create({150, 100});
+            auto widget1 = tgui::ClickableWidget::create();
+            auto widget2 = tgui::ClickableWidget::create();
+            widget1->setSize({"parent.width - 20", "min(50%, parent.height - 40)"});
+            widget2->setSize({"parent.width - 20", "min(50%, parent.height - 40)"});
+            panel1->add(widget1);
+            panel2->add(widget2);
+
+            REQUIRE(widget1->getSize() == tgui::Vector2f(280, 100));
+            REQUIRE(widget2->getSize() == tgui::Vector2f(130, 50));
+            REQUIRE(widget1->getSizeLayout().x.toString() == "parent.width - 20");
+            REQUIRE(widget2->getSizeLayout().y.toString() == "min(50%, parent.height - 40)");
+
+            panel1->setSize({200, 60});
+            REQUIRE(widget1->getSize() == tgui::Vector2f(180, 20));
+            REQUIRE(widget2->getSize() == tgui::Vector2f(130, 50));
+        }
     }
 
     SECTION("AutoLayout")
@@ -834,6 +856,168 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Deferred layout updates")
+    {
+        GuiNull gui;
+        gui.setDeferredLayoutEnabled(true);
+        REQUIRE(gui.isDeferredLayoutEnabled());
+
+        auto panel1 = tgui::Panel::create({40, 30});
+        gui.add(panel1);
+
+        auto panel2 = tgui::Panel::create({bindWidth(panel1), 20});
+        panel2->setPosition({bindRight(panel1), 0});
+        gui.add(panel2);
+        gui.updateLayouts();
+
+        unsigned int panel1SizeChangedCount = 0;
+        unsigned int panel2SizeChangedCount = 0;
+        unsigned int panel2PositionChangedCount = 0;
+        panel1->onSizeChange([&]{ ++panel1SizeChangedCount; });
+        panel2->onSizeChange([&]{ ++panel2SizeChangedCount; });
+        panel2->onPositionChange([&]{ ++panel2PositionChangedCount; });
+
+        SECTION("Changes are applied together")
+        {
+            panel1->setSize({50, 30});
+            panel1->setSize({60, 30});
+            REQUIRE(panel1->getSize() == tgui::Vector2f{60, 30});
+            REQUIRE(panel2->getSize() == tgui::Vector2f{40, 20});
+            REQUIRE(panel1SizeChangedCount == 0);
+
+            gui.updateLayouts();
+            REQUIRE(panel2->getPosition() == tgui::Vector2f{60, 0});
+            REQUIRE(panel2->getSize() == tgui::Vector2f{60, 20});
+            REQUIRE(panel1SizeChangedCount == 1);
+            REQUIRE(panel2SizeChangedCount == 1);
+            REQUIRE(panel2PositionChangedCount == 1);
+
+            // No signals are send when the size is changed back before the layouts are updated
+            panel1->setSize({70, 30});
+            panel1->setSize({60, 30});
+            gui.updateLayouts();
+            REQUIRE(panel1SizeChangedCount == 1);
+            REQUIRE(panel2SizeChangedCount == 1);
+        }
+
+        SECTION("Events update the layouts")
+        {
+            panel1->setSize({50, 30});
+
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = 80;
+            event.mouseMove.y = 10;
+            gui.handleEvent(event);
+            REQUIRE(panel2->getSize() == tgui::Vector2f{50, 20});
+            REQUIRE(panel2->isMouseOnWidget({80, 10}));
+        }
+
+        SECTION("Disabling deferred layouts")
+        {
+            panel1->setSize({50, 30});
+            gui.setDeferredLayoutEnabled(false);
+            REQUIRE(panel2->getSize() == tgui::Vector2f{50, 20});
+
+            panel1->setSize({45, 30});
+            REQUIRE(panel2->getSize() == tgui::Vector2f{45, 20});
+            REQUIRE(panel2SizeChangedCount == 2);
+        }
+
+        SECTION("AutoLayout")
+        {
+            auto outerPanelLeft = tgui::Panel::create({"10%", 0});
+            outerPanelLeft->setAutoLayout(tgui::AutoLayout::Left);
+            gui.add(outerPanelLeft);
+
+            auto container = tgui::Panel::create();
+            container->setAutoLayout(tgui::AutoLayout::Fill);
+            gui.add(container);
+
+            auto innerPanelFill = tgui::Panel::create();
+            innerPanelFill->setAutoLayout(tgui::AutoLayout::Fill);
+            container->add(innerPanelFill);
+
+            gui.updateLayouts();
+            REQUIRE(container->getPosition() == tgui::Vector2f{20, 0});
+            REQUIRE(innerPanelFill->getSize() == tgui::Vector2f{180, 200});
+
+            outerPanelLeft->setWidth("20%");
+            outerPanelLeft->setWidth("25%");
+            gui.updateLayouts();
+            REQUIRE(container->getPosition() == tgui::Vector2f{50, 0});
+            REQUIRE(container->getSize() == tgui::Vector2f{150, 200});
+            REQUIRE(innerPanelFill->getSize() == tgui::Vector2f{150, 200});
+        }
+
+        SECTION("Removing changed widget")
+        {
+            panel2->setSize({10, 10});
+            gui.remove(panel2);
+            panel2 = nullptr;
+
+            panel1->setSize({50, 30});
+            gui.remove(panel1);
+            REQUIRE(panel1SizeChangedCount == 1);
+
+            gui.updateLayouts();
+        }
+
+        SECTION("Moving changed widgets between other changed widgets")
+        {
+            // Widgets that are moved are dropped from the middle of the deferred layout queues
+            unsigned int sizeChangedCount = 0;
+            std::vector<tgui::Button::Ptr> buttons;
+            for (unsigned int i = 0; i < 5; ++i)
+            {
+                buttons.push_back(tgui::Button::create());
+                buttons.back()->onSizeChange([&]{ ++sizeChangedCount; });
+                gui.add(buttons.back());
+                buttons.back()->setSize({10, 10});
+            }
+
+            {
+                tgui::Button movedButton{std::move(*buttons[1])};
+            }
+            buttons[1] = nullptr;
+
+            *buttons[2] = tgui::Button{};
+            gui.remove(buttons[2]);
+            buttons[2] = nullptr;
+
+            buttons[3]->setSize({15, 15});
+            gui.updateLayouts();
+            REQUIRE(sizeChangedCount == 3);
+            REQUIRE(buttons[0]->getSize() == tgui::Vector2f{10, 10});
+            REQUIRE(buttons[3]->getSize() == tgui::Vector2f{15, 15});
+            REQUIRE(buttons[4]->getSize() == tgui::Vector2f{10, 10});
+        }
+
+        SECTION("Moving changed widget")
+        {
+            // Widgets that are moved are no longer part of the gui, so their pending changes are dropped
+            auto button = tgui::Button::create();
+            gui.add(button);
+            button->setSize({10, 10});
+            {
+                tgui::Button movedButton{std::move(*button)};
+                REQUIRE(movedButton.getSize() == tgui::Vector2f{10, 10});
+            }
+
+            auto assignedButton = tgui::Button::create();
+            gui.add(assignedButton);
+            assignedButton->setSize({20, 20});
+            *assignedButton = tgui::Button{};
+            gui.remove(assignedButton);
+            assignedButton = nullptr;
+
+            panel1->setSize({50, 30});
+            gui.updateLayouts();
+            REQUIRE(panel1SizeChangedCount == 1);
+            REQUIRE(panel2->getSize() == tgui::Vector2f{50, 20});
+        }
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
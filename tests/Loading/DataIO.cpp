@@ -103,6 +103,37 @@ TEST_CASE("[DataIO]")
                     == "\\\"Value\"\\");
         }
 
+        SECTION("Parse from memory")
+        {
+            const std::string input = "Child { /* comment **/ Property = [a, \"b,c\"]; } // Trailing comment";
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(tgui::CharStringView{input.data(), input.size()}));
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->name == "Child");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->value == "[a, \"b,c\"]");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Property"]->valueList[1] == "\"b,c\"");
+
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(tgui::CharStringView{"{ Property = Value"}), tgui::Exception);
+        }
+
+        SECTION("Non-ASCII characters")
+        {
+            // The words are encoded as UTF-8, each character should be decoded instead of widening every byte
+            std::stringstream input("Na\xC3\xAFve.\"\xE2\x82\xAC\" { Text = \"G\xC3\xBCl\"; }");
+
+            std::unique_ptr<tgui::DataIO::Node> rootNode;
+            REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(input));
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->name == U"Na\u00EFve.\"\u20AC\"");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["Text"]->value == U"\"G\u00FCl\"");
+
+            std::stringstream output;
+            tgui::DataIO::emit(rootNode, output);
+            REQUIRE(output.str() == "Na\xC3\xAFve.\"\xE2\x82\xAC\" {\n    Text = \"G\xC3\xBCl\";\n}\n");
+        }
+
         SECTION("Value can contain slash")
         {
             std::stringstream input("Property = First/Second;");
@@ -261,6 +292,43 @@ TEST_CASE("[DataIO]")
             tgui::DataIO::emit(root, stream);
         }
 
+        SECTION("binary")
+        {
+            std::stringstream input;
+            input << "GlobalProperty1 = GlobalValue1;\nGlobalProperty2 = GlobalValue2;\n"
+                  << "Child1 { Property = Value; NestedChild { PropertyA = ValueA; PropertyB = []; PropertyC = [X, Y, Z]; } }\n"
+                  << "{}";
+
+            const auto root = tgui::DataIO::parse(input);
+            tgui::DataIO::emitBinary(root, stream);
+            REQUIRE(tgui::DataIO::isBinary(stream.str()));
+            REQUIRE(!tgui::DataIO::isBinary("GlobalProperty1 = GlobalValue1;"));
+
+            // Parsing the binary data results in the same nodes as parsing the text
+            const std::string binaryData = stream.str();
+            std::stringstream textFromOriginal;
+            std::stringstream textFromBinary;
+            tgui::DataIO::emit(root, textFromOriginal);
+            tgui::DataIO::emit(tgui::DataIO::parse(binaryData), textFromBinary);
+            REQUIRE(textFromBinary.str() == textFromOriginal.str());
+
+            // Data that was cut off is detected
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(tgui::CharStringView{binaryData.data(), binaryData.size() - 1}), tgui::Exception);
+
+            // Element counts that can't fit in the data are rejected before memory is allocated for them
+            std::string corruptData = binaryData;
+            const std::size_t propertyCountPos = 8 + 4; // Behind the header and the length of the empty root name
+            for (std::size_t i = 0; i < 4; ++i)
+                corruptData[propertyCountPos + i] = '\xFF';
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(corruptData), tgui::Exception);
+
+            // Deeply nested nodes are rejected instead of overflowing the stack
+            std::string nestedData = binaryData.substr(0, 8);
+            for (unsigned int i = 0; i < 10000; ++i)
+                nestedData += std::string("\0\0\0\0" "\0\0\0\0" "\1\0\0\0", 12);
+            REQUIRE_THROWS_WITH(tgui::DataIO::parse(nestedData), Catch::Contains("nested too deeply"));
+        }
+
         SECTION("direct stream")
         {
             stream << "GlobalProperty1 = GlobalValue1;" << std::endl;
@@ -315,4 +383,87 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children[1]->children.empty());
         REQUIRE(parsedRoot->children[1]->propertyValuePairs.empty());
     }
+
+    SECTION("binary renderer values")
+    {
+        std::stringstream stream;
+        std::stringstream input;
+        input << "Button.Button1 {\n"
+              << "    Text = \"Hello\";\n"
+              << "    Renderer {\n"
+              << "        BackgroundColor = rgb(10, 20, 30);\n"
+              << "        Borders = (1, 2, 3, 4);\n"
+              << "        Padding = (10%, 1, 2, 3);\n"
+              << "        TextStyle = Bold | Italic;\n"
+              << "        Opacity = 0.5;\n"
+              << "        TransparentTexture = true;\n"
+              << "        Texture = \"image.png\" Part(1, 2, 3, 4) Smooth;\n"
+              << "        Font = \"font.ttf\";\n"
+              << "        UnknownProperty = Value;\n"
+              << "        Scrollbar { TrackColor = Red; }\n"
+              << "    }\n"
+              << "}";
+
+        tgui::DataIO::emitBinary(tgui::DataIO::parse(input), stream);
+        const auto root = tgui::DataIO::parse(stream.str());
+        REQUIRE(root->children.size() == 1);
+
+        // Widget properties are stored as text
+        const auto& widgetNode = root->children[0];
+        REQUIRE(!widgetNode->propertyValuePairs["Text"]->typed);
+        REQUIRE(widgetNode->propertyValuePairs["Text"]->value == "\"Hello\"");
+
+        // Renderer properties are stored with their type
+        REQUIRE(widgetNode->children.size() == 1);
+        auto& values = widgetNode->children[0]->propertyValuePairs;
+        REQUIRE(values["BackgroundColor"]->typed->type == tgui::ObjectConverter::Type::Color);
+        REQUIRE(values["BackgroundColor"]->typed->value.getColor() == tgui::Color{10, 20, 30});
+        REQUIRE(values["Borders"]->typed->type == tgui::ObjectConverter::Type::Outline);
+        REQUIRE(values["Borders"]->typed->value.getOutline() == tgui::Outline{1, 2, 3, 4});
+        REQUIRE(values["TextStyle"]->typed->type == tgui::ObjectConverter::Type::TextStyle);
+        REQUIRE(values["TextStyle"]->typed->value.getTextStyle() == (tgui::TextStyle::Bold | tgui::TextStyle::Italic));
+        REQUIRE(values["Opacity"]->typed->type == tgui::ObjectConverter::Type::Number);
+        REQUIRE(values["Opacity"]->typed->value.getNumber() == 0.5f);
+        REQUIRE(values["TransparentTexture"]->typed->type == tgui::ObjectConverter::Type::Bool);
+        REQUIRE(values["TransparentTexture"]->typed->value.getBool());
+        REQUIRE(tgui::DataIO::createObjectConverter(*values["Borders"]) == tgui::ObjectConverter{tgui::Outline{1, 2, 3, 4}});
+
+        // Textures and fonts are stored as filenames, so that they can still be loaded relative to the form or theme file
+        REQUIRE(values["Texture"]->typed->type == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(values["Texture"]->value == "image.png");
+        REQUIRE(values["Texture"]->typed->texturePartRect == tgui::UIntRect{1, 2, 3, 4});
+        REQUIRE(values["Texture"]->typed->textureMiddleRect == tgui::UIntRect{});
+        REQUIRE(values["Texture"]->typed->textureSmooth);
+        REQUIRE(*values["Texture"]->typed->textureSmooth);
+        REQUIRE(tgui::DataIO::serializeValue(*values["Texture"]) == "\"image.png\" Part(1, 2, 3, 4) Smooth");
+        REQUIRE(values["Font"]->typed->type == tgui::ObjectConverter::Type::Font);
+        REQUIRE(values["Font"]->value == "font.ttf");
+
+        // Unknown properties and outlines with relative values remain text
+        REQUIRE(!values["UnknownProperty"]->typed);
+        REQUIRE(values["UnknownProperty"]->value == "Value");
+        REQUIRE(!values["Padding"]->typed);
+        REQUIRE(values["Padding"]->value == "(10%, 1, 2, 3)");
+        REQUIRE(tgui::DataIO::createObjectConverter(*values["Padding"]).getType() == tgui::ObjectConverter::Type::String);
+
+        // The types are taken from the definitions of the renderer properties
+        REQUIRE(tgui::RendererData::getPropertyType("BackgroundColor") == tgui::ObjectConverter::Type::Color);
+        REQUIRE(tgui::RendererData::getPropertyType("TitleBarHeight") == tgui::ObjectConverter::Type::Number);
+        REQUIRE(tgui::RendererData::getPropertyType("UnknownProperty") == tgui::ObjectConverter::Type::None);
+
+        // Nested renderers are deserialized as well
+        REQUIRE(widgetNode->children[0]->children.size() == 1);
+        auto& nestedValues = widgetNode->children[0]->children[0]->propertyValuePairs;
+        REQUIRE(nestedValues["TrackColor"]->typed->type == tgui::ObjectConverter::Type::Color);
+        REQUIRE(nestedValues["TrackColor"]->typed->value.getColor() == tgui::Color::Red);
+
+        // The typed values can be written back as text
+        std::stringstream text;
+        tgui::DataIO::emit(root, text);
+        const auto rootFromText = tgui::DataIO::parse(text);
+        auto& valuesFromText = rootFromText->children[0]->children[0]->propertyValuePairs;
+        REQUIRE(valuesFromText["BackgroundColor"]->value == "#0A141E");
+        REQUIRE(valuesFromText["Borders"]->value == "(1, 2, 3, 4)");
+        REQUIRE(valuesFromText["Font"]->value == "\"font.ttf\"");
+    }
 }
@@ -22,6 +22,10 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <functional>
+#include <fstream>
+#include <cstdio>
+
 #include "Tests.hpp"
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
@@ -110,6 +114,70 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["ListBox"] == "{\nBackgroundColor = Cyan;\n\nScrollbar {\n    TrackColor = Black;\n}\n}");
     }
 
+    SECTION("load compiled theme")
+    {
+        std::stringstream stream;
+        tgui::DefaultThemeLoader::compileToBinary("resources/ThemeNested.txt", stream);
+
+        // References to sections were already resolved while compiling and the values were stored with their type
+        auto root = tgui::DataIO::parse(stream.str());
+        REQUIRE(root->children.size() == 9);
+        REQUIRE(root->children[0]->name == "ComboBox1");
+        REQUIRE(root->children[0]->propertyValuePairs.empty());
+        REQUIRE(root->children[0]->children.size() == 1);
+        REQUIRE(root->children[0]->children[0]->name == "ListBox");
+        REQUIRE(root->children[0]->children[0]->propertyValuePairs["BackgroundColor"]->typed->type == tgui::ObjectConverter::Type::Color);
+
+        {
+            std::ofstream file{"ThemeNestedCompiled.txt", std::ios::binary};
+            file << stream.str();
+        }
+
+        // The renderers get typed values that don't have to be deserialized anymore
+        auto values = loader->loadValues("ThemeNestedCompiled.txt", "ComboBox4");
+        REQUIRE(values.size() == 1);
+        REQUIRE(values["ListBox"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto listBoxValues = values["ListBox"].getRenderer()->propertyValuePairs;
+        REQUIRE(listBoxValues["BackgroundColor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(listBoxValues["BackgroundColor"].getColor() == tgui::Color::Magenta);
+        REQUIRE(listBoxValues["Scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        auto scrollbarValues = listBoxValues["Scrollbar"].getRenderer()->propertyValuePairs;
+        REQUIRE(scrollbarValues["ThumbColor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(scrollbarValues["ThumbColor"].getColor() == tgui::Color::Green);
+        REQUIRE(scrollbarValues["TrackColor"].getColor() == tgui::Color::Red);
+
+        // Loading the compiled theme results in the same values as loading the original theme
+        std::function<void(std::map<tgui::String, tgui::ObjectConverter>&, std::map<tgui::String, tgui::ObjectConverter>&)> compareValues =
+            [&compareValues](std::map<tgui::String, tgui::ObjectConverter>& compiled, std::map<tgui::String, tgui::ObjectConverter>& original)
+            {
+                REQUIRE(compiled.size() == original.size());
+                for (auto& pair : compiled)
+                {
+                    REQUIRE(original.count(pair.first) == 1);
+                    if (pair.second.getType() == tgui::ObjectConverter::Type::RendererData)
+                        compareValues(pair.second.getRenderer()->propertyValuePairs, original[pair.first].getRenderer()->propertyValuePairs);
+                    else
+                        REQUIRE(pair.second.getColor() == original[pair.first].getColor());
+                }
+            };
+
+        for (const auto& section : {"ComboBox1", "ComboBox2", "ComboBox3", "ComboBox4", "ComboBox5", "ListBox1", "ListBox2", "ListBox3"})
+        {
+            auto compiledValues = loader->loadValues("ThemeNestedCompiled.txt", section);
+            auto originalValues = loader->loadValues("resources/ThemeNested.txt", section);
+            compareValues(compiledValues, originalValues);
+        }
+
+        // The typed values are serialized again when the text of the properties is requested
+        auto properties = loader->load("ThemeNestedCompiled.txt", "ListBox3");
+        REQUIRE(properties.size() == 1);
+        REQUIRE(properties["Scrollbar"] == "{\nTrackColor = yellow;\n}");
+
+        REQUIRE_THROWS_AS(tgui::DefaultThemeLoader::compileToBinary("resources/nonexistent.txt", stream), tgui::Exception);
+
+        std::remove("ThemeNestedCompiled.txt");
+    }
+
     SECTION("cache")
     {
         REQUIRE(loader->getPropertiesCache().size() == 0);
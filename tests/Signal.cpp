@@ -104,11 +104,14 @@ TEST_CASE("[Signal]")
     SECTION("disconnect")
     {
         unsigned int i = 0;
+        REQUIRE(!widget->onPositionChange.hasHandlers());
         unsigned int id = widget->onPositionChange([&](){ i++; });
+        REQUIRE(widget->onPositionChange.hasHandlers());
         widget->setPosition(10, 10);
         REQUIRE(i == 1);
 
         REQUIRE(widget->onPositionChange.disconnect(id));
+        REQUIRE(!widget->onPositionChange.hasHandlers());
         REQUIRE_FALSE(widget->onPositionChange.disconnect(id));
         widget->setPosition(20, 20);
         REQUIRE(i == 1);
@@ -116,6 +119,7 @@ TEST_CASE("[Signal]")
         widget->onPositionChange([&](){ i++; });
         widget->onSizeChange([&](){ i++; });
         widget->onPositionChange.disconnectAll();
+        REQUIRE(!widget->onPositionChange.hasHandlers());
         widget->setPosition(30, 30);
         widget->setSize(100, 25);
         REQUIRE(i == 2);
@@ -129,6 +133,73 @@ TEST_CASE("[Signal]")
         REQUIRE(i == 4);
     }
 
+    SECTION("Change handlers while emitting")
+    {
+        tgui::Signal signal{"Test"};
+        unsigned int calls = 0;
+        unsigned int id2 = 0;
+        unsigned int id3 = 0;
+
+        const unsigned int id1 = signal.connect([&]{
+            calls++;
+            REQUIRE(signal.disconnect(id1));
+            REQUIRE(signal.disconnect(id2));
+            id3 = signal.connect([&]{ calls += 10; });
+        });
+        id2 = signal.connect([&]{ calls += 100; });
+
+        // Handlers that are disconnected are no longer called, handlers that are connected are only called on the next emit
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == 1);
+
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == 11);
+
+        REQUIRE(signal.disconnect(id3));
+        REQUIRE(!signal.emit(nullptr));
+        REQUIRE(calls == 11);
+    }
+
+    SECTION("Destroy widget in handler")
+    {
+        unsigned int calls = 0;
+        widget->onPositionChange([&]{ widget = nullptr; calls++; });
+        widget->onPositionChange([&]{ calls++; });
+        widget->setPosition(10, 10);
+        REQUIRE(widget == nullptr);
+        REQUIRE(calls == 2);
+    }
+
+    SECTION("Name")
+    {
+        // A signal only stores a pointer to its name and to its handler list
+        REQUIRE(sizeof(tgui::Signal) <= 5 * sizeof(void*));
+
+        tgui::Signal literalSignal{"Literal"};
+        REQUIRE(literalSignal.getName() == "Literal");
+
+        // A name that is passed as a pointer is copied, so the buffer containing it may be changed or destroyed before the signal
+        std::unique_ptr<tgui::SignalFloat> bufferSignal;
+        {
+            char buffer[] = "Buffer";
+            const char* bufferPtr = buffer;
+            bufferSignal = std::make_unique<tgui::SignalFloat>(bufferPtr);
+            buffer[0] = 'X';
+        }
+        REQUIRE(bufferSignal->getName() == "Buffer");
+
+        std::unique_ptr<tgui::SignalFloat> signal;
+        {
+            tgui::String name = "Dynamic" + tgui::String::fromNumber(5);
+            signal = std::make_unique<tgui::SignalFloat>(std::move(name));
+        }
+        REQUIRE(signal->getName() == "Dynamic5");
+
+        const tgui::SignalFloat signalCopy = *signal;
+        signal = nullptr;
+        REQUIRE(signalCopy.getName() == "Dynamic5");
+    }
+
     SECTION("Reference")
     {
         tgui::Signal signal{"Test"};
@@ -159,3 +230,24 @@ TEST_CASE("[Signal]")
         REQUIRE(i == 1);
     }
 }
+
+// Hidden test that isn't executed by default, run it by passing "[.benchmark]" as argument to the test executable
+TEST_CASE("[Signal] emit benchmark", "[.benchmark]")
+{
+    constexpr unsigned int emitCount = 1000000;
+    for (const unsigned int handlerCount : {0u, 1u, 8u})
+    {
+        tgui::SignalFloat signal{"Test"};
+        unsigned int calls = 0;
+        for (unsigned int i = 0; i < handlerCount; ++i)
+            signal.connect([&calls](float){ ++calls; });
+
+        const auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < emitCount; ++i)
+            signal.emit(nullptr, static_cast<float>(i));
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+
+        REQUIRE(calls == handlerCount * emitCount);
+        WARN("Emitted signal with " << handlerCount << " handlers " << emitCount << " times in " << (duration.count() / 1000.0) << " ms");
+    }
+}
@@ -54,6 +54,77 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Shared textures")
+    {
+        tgui::SvgImage svgImage{"resources/SFML.svg"};
+        const std::size_t oldMemoryUsage = tgui::SvgImage::getTextureCacheMemoryUsage();
+
+        auto texture1 = svgImage.getTexture({50, 40});
+        auto texture2 = svgImage.getTexture({60, 60});
+        REQUIRE(texture1 != texture2);
+        REQUIRE(svgImage.getTexture({50, 40}) == texture1);
+        REQUIRE(tgui::Vector2u{texture1->getSize()} == tgui::Vector2u{50, 40});
+        REQUIRE(tgui::SvgImage::getTextureCacheMemoryUsage() == oldMemoryUsage + (50 * 40 * 4) + (60 * 60 * 4));
+
+        SECTION("Sprites")
+        {
+            tgui::Sprite sprite1{tgui::Texture{"resources/SFML.svg"}};
+            tgui::Sprite sprite2{tgui::Texture{"resources/SFML.svg"}};
+            sprite1.setSize({80, 70});
+            sprite2.setSize({80, 70});
+            REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+
+            tgui::Sprite sprite3 = sprite1;
+            REQUIRE(sprite3.getSvgTexture() == sprite1.getSvgTexture());
+
+            sprite2.setSize({70, 70});
+            REQUIRE(sprite2.getSvgTexture() != sprite1.getSvgTexture());
+        }
+
+        SECTION("Budget")
+        {
+            const std::size_t oldBudget = tgui::SvgImage::getTextureCacheBudget();
+
+            // Textures that are still used are never removed
+            tgui::SvgImage::setTextureCacheBudget(0);
+            REQUIRE(tgui::SvgImage::getTextureCacheBudget() == 0);
+            REQUIRE(tgui::SvgImage::getTextureCacheMemoryUsage() >= (50 * 40 * 4) + (60 * 60 * 4));
+
+            texture2 = nullptr;
+            tgui::SvgImage::setTextureCacheBudget(oldMemoryUsage + (50 * 40 * 4));
+            REQUIRE(tgui::SvgImage::getTextureCacheMemoryUsage() <= oldMemoryUsage + (50 * 40 * 4));
+            REQUIRE(svgImage.getTexture({50, 40}) == texture1);
+
+            tgui::SvgImage::setTextureCacheBudget(oldBudget);
+        }
+    }
+
+    SECTION("Background rasterization")
+    {
+        REQUIRE(!tgui::SvgImage::isAsyncRasterizationEnabled());
+        tgui::SvgImage::setAsyncRasterizationEnabled(true);
+        REQUIRE(tgui::SvgImage::isAsyncRasterizationEnabled());
+
+        tgui::Sprite sprite{tgui::Texture{"resources/SFML.svg"}};
+        tgui::getBackend()->waitForSvgRasterizations();
+        REQUIRE(tgui::Vector2u{sprite.getSvgTexture()->getSize()} == tgui::Vector2u{130, 130});
+
+        // The old texture is used until the new one has been uploaded
+        sprite.setSize({91, 93});
+        REQUIRE(tgui::SvgImage::getPendingRasterizationCount() == 1);
+        REQUIRE(tgui::Vector2u{sprite.getSvgTexture()->getSize()} == tgui::Vector2u{130, 130});
+
+        sprite.setSize({97, 95});
+        REQUIRE(tgui::SvgImage::getPendingRasterizationCount() >= 1);
+
+        tgui::getBackend()->waitForSvgRasterizations();
+        REQUIRE(tgui::SvgImage::getPendingRasterizationCount() == 0);
+        REQUIRE(tgui::Vector2u{sprite.getSvgTexture()->getSize()} == tgui::Vector2u{97, 95});
+        REQUIRE(!tgui::getBackend()->updateSvgTextures());
+
+        tgui::SvgImage::setAsyncRasterizationEnabled(false);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
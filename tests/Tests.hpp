@@ -238,6 +238,7 @@ public:
     void mainLoop(tgui::Color = {240, 240, 240}) override {}
 
     void handleTwoFingerScroll(bool wasAlreadyScrolling) { BackendGui::handleTwoFingerScroll(wasAlreadyScrolling); }
+    void waitForPostedTasks(tgui::Duration maxDuration) { BackendGui::waitForPostedTasks(maxDuration); }
 
     tgui::TwoFingerScrollDetect& twoFingerScroll = m_twoFingerScroll;
 };
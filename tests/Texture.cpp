@@ -241,6 +241,51 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("Atlas")
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        const tgui::Texture separateTexture{"resources/TransparentParts.png", {}, {}, true};
+
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+        {
+            const tgui::Texture texture1{"resources/image.png", {}, {10, 0, 30, 50}, false};
+            const tgui::Texture texture2{"resources/TransparentParts.png", {}, {}, false};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+
+            REQUIRE(texture1.getData()->backendTexture == texture2.getData()->backendTexture);
+            REQUIRE(texture1.getData()->backendTexture->getSize() == tgui::Vector2u(tgui::TextureManager::getAtlasPageSize(), tgui::TextureManager::getAtlasPageSize()));
+            REQUIRE(texture1.getData()->atlasRect.getSize() == tgui::Vector2u(50, 50));
+            REQUIRE(texture2.getData()->atlasRect.getSize() == tgui::Vector2u(50, 50));
+            REQUIRE(!texture1.getData()->atlasRect.intersects(texture2.getData()->atlasRect));
+            REQUIRE(!texture1.isSmooth());
+
+            // Part and middle rects remain relative to the image
+            REQUIRE(texture1.getPartRect() == tgui::UIntRect(0, 0, 50, 50));
+            REQUIRE(texture1.getImageSize() == tgui::Vector2u(50, 50));
+            REQUIRE(texture1.getMiddleRect() == tgui::UIntRect(10, 0, 30, 50));
+
+            for (unsigned int y = 0; y < 50; y += 7)
+            {
+                for (unsigned int x = 0; x < 50; x += 7)
+                    REQUIRE(texture2.isTransparentPixel({x, y}) == separateTexture.isTransparentPixel({x, y}));
+            }
+
+            // Images larger than the maximum size get a texture of their own
+            tgui::TextureManager::setAtlasMaxImageSize(40);
+            const tgui::Texture texture3{"resources/image.png", {}, {}, true};
+            REQUIRE(texture3.getData()->atlasRect == tgui::UIntRect());
+            REQUIRE(texture3.getData()->backendTexture->getSize() == tgui::Vector2u(50, 50));
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            tgui::TextureManager::setAtlasMaxImageSize(256);
+        }
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        tgui::TextureManager::setAtlasEnabled(false);
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
@@ -305,6 +350,104 @@ TEST_CASE("[Texture]")
     }
 #endif
 
+    SECTION("updatePixels")
+    {
+        auto backendTexture = tgui::getBackend()->getRenderer()->createTexture();
+
+        auto pixels = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(2 * 2 * 4);
+        for (unsigned int i = 0; i < 2 * 2 * 4; ++i)
+            pixels[i] = 255;
+        REQUIRE(backendTexture->load({2, 2}, std::move(pixels), false));
+        REQUIRE(!backendTexture->isTransparentPixel({1, 0}));
+
+        const std::uint8_t newPixels[] = {255, 255, 255, 0};
+        REQUIRE(backendTexture->updatePixels({1, 0, 1, 1}, newPixels));
+        REQUIRE(backendTexture->getSize() == tgui::Vector2u{2, 2});
+        REQUIRE(backendTexture->isTransparentPixel({1, 0}));
+        REQUIRE(!backendTexture->isTransparentPixel({0, 0}));
+        REQUIRE(!backendTexture->isTransparentPixel({1, 1}));
+
+        // The base class doesn't know how to update the pixels, it has to be reloaded instead
+        tgui::BackendTexture baseTexture;
+        REQUIRE(!baseTexture.updatePixels({0, 0, 1, 1}, newPixels));
+    }
+
+    SECTION("PixelRetention")
+    {
+        REQUIRE(tgui::BackendTexture::getDefaultPixelRetention() == tgui::BackendTexture::PixelRetention::Full);
+
+        auto createPixels = []{
+            auto pixels = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(3 * 3 * 4);
+            for (unsigned int i = 0; i < 3 * 3 * 4; ++i)
+                pixels[i] = ((i % 4 == 3) && (i / 4 == 4)) ? 0 : 255; // Only the center pixel is transparent
+            return pixels;
+        };
+
+        tgui::BackendTexture backendTexture;
+        REQUIRE(backendTexture.getPixelRetention() == tgui::BackendTexture::PixelRetention::Full);
+        backendTexture.setPixelRetention(tgui::BackendTexture::PixelRetention::AlphaMask);
+        REQUIRE(backendTexture.getPixelRetention() == tgui::BackendTexture::PixelRetention::AlphaMask);
+        REQUIRE(backendTexture.load({3, 3}, createPixels(), false));
+        REQUIRE(backendTexture.getPixels() == nullptr);
+        REQUIRE(backendTexture.isTransparentPixel({1, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({0, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({2, 2}));
+
+        backendTexture.setPixelRetention(tgui::BackendTexture::PixelRetention::Full);
+        REQUIRE(backendTexture.getPixels() == nullptr);
+        REQUIRE(backendTexture.load({3, 3}, createPixels(), false));
+        REQUIRE(backendTexture.getPixels() != nullptr);
+        REQUIRE(backendTexture.isTransparentPixel({1, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({2, 1}));
+
+        // Reducing the retention of a loaded texture drops the stored information
+        backendTexture.setPixelRetention(tgui::BackendTexture::PixelRetention::AlphaMask);
+        REQUIRE(backendTexture.getPixels() == nullptr);
+        REQUIRE(backendTexture.isTransparentPixel({1, 1}));
+        REQUIRE(!backendTexture.isTransparentPixel({1, 2}));
+
+        backendTexture.setPixelRetention(tgui::BackendTexture::PixelRetention::None);
+        REQUIRE(!backendTexture.isTransparentPixel({1, 1}));
+
+        // Textures loaded from memory keep their pixels, because they can only be serialized by saving the pixels
+        tgui::Texture texture;
+        texture.loadFromPixelData({3, 3}, createPixels().get());
+        REQUIRE(texture.getData()->backendTexture->getPixels() != nullptr);
+        REQUIRE(texture.isTransparentPixel({1, 1}));
+
+        tgui::BackendTexture::setDefaultPixelRetention(tgui::BackendTexture::PixelRetention::None);
+        REQUIRE(tgui::BackendTexture().getPixelRetention() == tgui::BackendTexture::PixelRetention::None);
+        tgui::BackendTexture::setDefaultPixelRetention(tgui::BackendTexture::PixelRetention::Full);
+    }
+
+    SECTION("loadAlphaTextureOnly")
+    {
+        auto backendTexture = tgui::getBackend()->getRenderer()->createTexture();
+        REQUIRE(!backendTexture->isAlphaTexture());
+
+        const std::uint8_t alphaPixels[] = {255, 0, 0, 255, 128, 0};
+        if (tgui::getBackend()->getRenderer()->supportsAlphaTextures())
+        {
+            REQUIRE(backendTexture->loadAlphaTextureOnly({3, 2}, alphaPixels, false));
+            REQUIRE(backendTexture->isAlphaTexture());
+            REQUIRE(backendTexture->getSize() == tgui::Vector2u{3, 2});
+
+            // Updates of single-channel textures use 1 byte per pixel
+            const std::uint8_t newPixels[] = {0, 255};
+            REQUIRE(backendTexture->updatePixels({1, 1, 2, 1}, newPixels));
+        }
+        else
+        {
+            REQUIRE(!backendTexture->loadAlphaTextureOnly({3, 2}, alphaPixels, false));
+            REQUIRE(!backendTexture->isAlphaTexture());
+        }
+
+        // Loading RGBA pixels afterwards turns it back into a normal texture
+        const std::uint8_t rgbaPixels[] = {255, 255, 255, 255};
+        REQUIRE(backendTexture->loadTextureOnly({1, 1}, rgbaPixels, false));
+        REQUIRE(!backendTexture->isAlphaTexture());
+    }
+
     SECTION("BackendTextureLoader")
     {
         unsigned int count = 0;
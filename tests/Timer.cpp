@@ -168,4 +168,109 @@ TEST_CASE("[Timer]")
         duration = tgui::Timer::getNextScheduledTime();
         REQUIRE(!duration); // No active timers
     }
+
+    SECTION("Many timers")
+    {
+        std::vector<int> triggeredTimers;
+        std::vector<std::shared_ptr<tgui::Timer>> timers;
+        for (int i = 0; i < 50; ++i)
+        {
+            // Intervals are 10ms, 20ms, ..., 500ms but the timers are started in a mixed order
+            const int interval = 10 * (1 + (i * 17) % 50);
+            timers.push_back(tgui::Timer::create([&triggeredTimers,interval]{ triggeredTimers.push_back(interval); }, interval));
+        }
+
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(10));
+
+        for (int i = 1; i <= 50; ++i)
+        {
+            REQUIRE(tgui::Timer::updateTime(std::chrono::milliseconds(10)));
+            REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(10));
+        }
+
+        // Timers are triggered in the order in which they expire, or in the order in which they were started if they expire together
+        REQUIRE(triggeredTimers.size() > 4);
+        REQUIRE(triggeredTimers[0] == 10);
+        REQUIRE(triggeredTimers[1] == 20);
+        REQUIRE(triggeredTimers[2] == 10);
+        REQUIRE(triggeredTimers[3] == 30);
+        REQUIRE(triggeredTimers[4] == 10);
+
+        // Stopping timers removes them from the queue
+        for (std::size_t i = 0; i < timers.size(); i += 2)
+            timers[i]->setEnabled(false);
+        for (std::size_t i = 1; i < timers.size(); i += 2)
+            REQUIRE(timers[i]->isEnabled());
+
+        triggeredTimers.clear();
+        tgui::Timer::updateTime(std::chrono::milliseconds(500));
+        REQUIRE(triggeredTimers.size() == 25);
+
+        for (std::size_t i = 1; i < timers.size(); i += 2)
+            timers[i]->setEnabled(false);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
+
+    SECTION("Changing timers in callback")
+    {
+        std::shared_ptr<tgui::Timer> timer2;
+        auto timer1 = tgui::Timer::create([&]{ ++count; timer2->setEnabled(false); }, 100);
+        timer2 = tgui::Timer::create(callback, 100);
+
+        // A timer isn't triggered when the callback of another timer that expired at the same time stopped it
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 1);
+        REQUIRE(!timer2->isEnabled());
+
+        timer1->setCallback(callback);
+        timer2->setEnabled(true);
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 3);
+
+        // A timer that is started in a callback isn't triggered in the same update, even without interval
+        timer1->setCallback([&]{ ++count; tgui::Timer::scheduleCallback(callback); });
+        timer2->setEnabled(false);
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 4);
+        tgui::Timer::updateTime(std::chrono::milliseconds(10));
+        REQUIRE(count == 5);
+
+        // Timers can restart themselves
+        timer1->setCallback([&]{ ++count; timer1->setInterval(300); });
+        tgui::Timer::updateTime(std::chrono::milliseconds(90));
+        REQUIRE(count == 6);
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(300));
+
+        timer1->setEnabled(false);
+    }
+
+    SECTION("Coalescing")
+    {
+        REQUIRE(!tgui::Timer::isCoalescingEnabled());
+        tgui::Timer::setCoalescingEnabled(true);
+        REQUIRE(tgui::Timer::isCoalescingEnabled());
+
+        // Timers with an interval around 512ms expire at a multiple of 32ms, use this to start the test at such a multiple
+        auto timer = tgui::Timer::create(callback, 512);
+        tgui::Timer::updateTime(*tgui::Timer::getNextScheduledTime());
+        timer->setEnabled(false);
+        count = 0;
+
+        // The timers would expire 7ms apart without coalescing, but both expire at 608ms
+        auto timer1 = tgui::Timer::create(callback, 600);
+        tgui::Timer::updateTime(std::chrono::milliseconds(3));
+        auto timer2 = tgui::Timer::create(callback, 590);
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(605));
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(605));
+        REQUIRE(count == 2);
+
+        // Short intervals aren't changed
+        timer1->setInterval(10);
+        timer2->setEnabled(false);
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(10));
+
+        timer1->setEnabled(false);
+        tgui::Timer::setCoalescingEnabled(false);
+    }
 }
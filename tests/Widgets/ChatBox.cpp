@@ -134,6 +134,46 @@ TEST_CASE("[ChatBox]")
         }
     }
 
+    SECTION("Text height")
+    {
+        chatBox->setSize(150, 100);
+
+        auto otherChatBox = tgui::ChatBox::copy(chatBox);
+        for (unsigned int i = 0; i < 20; ++i)
+            otherChatBox->addLine("Line " + tgui::String(i) + ((i % 3 == 0) ? " with enough text to be word-wrapped" : ""));
+        REQUIRE(otherChatBox->getScrollbarMaxValue() > 0);
+
+        // The height is updated incrementally when adding and removing lines at both ends
+        chatBox->setNewLinesBelowOthers(false);
+        for (unsigned int i = 10; i > 0; --i)
+            chatBox->addLine("Line " + tgui::String(i-1) + (((i-1) % 3 == 0) ? " with enough text to be word-wrapped" : ""));
+        chatBox->setNewLinesBelowOthers(true);
+        chatBox->addLine("Removed line");
+        REQUIRE(chatBox->removeLine(10));
+        for (unsigned int i = 10; i < 20; ++i)
+            chatBox->addLine("Line " + tgui::String(i) + ((i % 3 == 0) ? " with enough text to be word-wrapped" : ""));
+        REQUIRE(chatBox->getScrollbarMaxValue() == otherChatBox->getScrollbarMaxValue());
+
+        chatBox->setLineLimit(12);
+        otherChatBox->setLineLimit(12);
+        REQUIRE(chatBox->getScrollbarMaxValue() == otherChatBox->getScrollbarMaxValue());
+
+        REQUIRE(chatBox->removeLine(3));
+        REQUIRE(otherChatBox->removeLine(3));
+        REQUIRE(chatBox->removeLine(8));
+        REQUIRE(otherChatBox->removeLine(8));
+        REQUIRE(chatBox->removeLine(0));
+        REQUIRE(otherChatBox->removeLine(0));
+        REQUIRE(chatBox->getScrollbarMaxValue() == otherChatBox->getScrollbarMaxValue());
+
+        otherChatBox->setTextSize(otherChatBox->getTextSize());
+        REQUIRE(chatBox->getScrollbarMaxValue() == otherChatBox->getScrollbarMaxValue());
+
+        chatBox->removeAllLines();
+        otherChatBox->removeAllLines();
+        REQUIRE(chatBox->getScrollbarMaxValue() == otherChatBox->getScrollbarMaxValue());
+    }
+
     SECTION("Text size")
     {
         chatBox->setTextSize(30);
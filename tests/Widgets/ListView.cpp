@@ -250,6 +250,46 @@ TEST_CASE("[ListView]")
 
         listView->sort(2, cmp2);
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
+
+        SECTION("Without comparator")
+        {
+            listView->addItem({"40", "b", "+4.5"});
+
+            // Numbers are compared on their value
+            listView->sortByColumn(0);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"40", "200", "300", "1000"});
+            listView->sortByColumn(0, false);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"1000", "300", "200", "40"});
+
+            // Empty cells are placed before numbers, items with equal values keep their order
+            listView->sortByColumn(2);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"1000", "300", "40", "200"});
+
+            // Texts are compared when not all values are numbers
+            listView->sortByColumn(1, false);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"40", "1000", "200", "300"});
+
+            listView->sortByColumn(5);
+            REQUIRE(listView->getItems() == std::vector<tgui::String>{"40", "1000", "200", "300"});
+        }
+
+        SECTION("Many items")
+        {
+            const std::size_t itemCount = 100000;
+            listView->setVirtualItems(itemCount, [](std::size_t itemIndex, std::size_t columnIndex){
+                return tgui::String((itemIndex * 7919 + columnIndex) % 100003);
+            });
+
+            listView->sortByColumn(0);
+            unsigned int prevValue = 0;
+            for (std::size_t i = 0; i < itemCount; ++i)
+            {
+                const unsigned int value = listView->getItem(i).toUInt();
+                if (value < prevValue)
+                    FAIL("Items aren't sorted at index " << i);
+                prevValue = value;
+            }
+        }
     }
 
     SECTION("Returned item rows depend on columns")
@@ -325,6 +365,64 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ });
     }
 
+    SECTION("Virtual items")
+    {
+        listView->setSize(200, 100);
+        listView->setItemHeight(20);
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem("Normal item");
+        REQUIRE(!listView->isVirtual());
+
+        std::size_t providerCalls = 0;
+        listView->setVirtualItems(1000000, [&](std::size_t itemIndex, std::size_t columnIndex){
+            ++providerCalls;
+            return tgui::String(itemIndex) + "," + tgui::String(columnIndex);
+        });
+        REQUIRE(listView->isVirtual());
+        REQUIRE(listView->getItemCount() == 1000000);
+        REQUIRE(listView->getVerticalScrollbarMaxValue() > 0);
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+
+        // Only the visible items are requested
+        REQUIRE(providerCalls > 0);
+        REQUIRE(providerCalls < 20);
+
+        REQUIRE(listView->getItem(999999) == "999999,0");
+        REQUIRE(listView->getItemCell(5, 1) == "5,1");
+        REQUIRE(listView->getItemCell(5, 2) == "");
+        REQUIRE(listView->getItemCell(1000000, 0) == "");
+        REQUIRE(listView->getItemRow(7) == std::vector<tgui::String>{"7,0", "7,1"});
+
+        // Scrolling a bit only requests the items that became visible
+        providerCalls = 0;
+        listView->setVerticalScrollbarValue(40);
+        REQUIRE(providerCalls == 4);
+        providerCalls = 0;
+        listView->setVerticalScrollbarValue(0);
+        REQUIRE(providerCalls == 4);
+
+        listView->setSelectedItem(500000);
+        REQUIRE(listView->getSelectedItemIndex() == 500000);
+        REQUIRE(listView->getVerticalScrollbarValue() > 0);
+
+        listView->setVirtualItemCount(100);
+        REQUIRE(listView->getItemCount() == 100);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+
+        listView->setVirtualItemCount(3);
+        listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a > b; });
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"2,0", "2,1"}, {"1,0", "1,1"}, {"0,0", "0,1"}});
+        REQUIRE(listView->getVirtualItemIndex(0) == 2);
+
+        listView->setVirtualItemCount(4);
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"2,0", "1,0", "0,0", "3,0"});
+
+        listView->removeAllItems();
+        REQUIRE(!listView->isVirtual());
+        REQUIRE(listView->getItemCount() == 0);
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -41,6 +41,23 @@ namespace
 #endif
         return event;
     }
+
+    // Gives access to the lines of the text area, to compare them with the lines of a text area that word-wrapped the entire text
+    class TextAreaLines : public tgui::TextArea
+    {
+    public:
+        void requireSameLines(const TextAreaLines& other) const
+        {
+            REQUIRE(m_lines == other.m_lines);
+            REQUIRE(m_lineWidths == other.m_lineWidths);
+            for (std::size_t i = 0; i < m_lines.size(); ++i)
+                REQUIRE(getLineStart(i) - m_textStart == other.getLineStart(i) - other.m_textStart);
+
+            REQUIRE(m_maxLineWidth == other.m_maxLineWidth);
+            REQUIRE(m_selStart == other.m_selStart);
+            REQUIRE(m_selEnd == other.m_selEnd);
+        }
+    };
 }
 
 TEST_CASE("[TextArea]")
@@ -53,9 +70,13 @@ TEST_CASE("[TextArea]")
         textArea->onTextChange([](){});
         textArea->onTextChange([](const tgui::String&){});
 
+        textArea->onTextAppend([](){});
+        textArea->onTextAppend([](const tgui::String&){});
+
         textArea->onCaretPositionChange([](){});
 
         REQUIRE_NOTHROW(tgui::Widget::Ptr(textArea)->getSignal("TextChanged").connect([]{}));
+        REQUIRE_NOTHROW(tgui::Widget::Ptr(textArea)->getSignal("TextAppended").connect([]{}));
         REQUIRE_NOTHROW(tgui::Widget::Ptr(textArea)->getSignal("CaretPositionChanged").connect([]{}));
     }
 
@@ -168,6 +189,95 @@ TEST_CASE("[TextArea]")
         }
     }
 
+    SECTION("MaximumLines")
+    {
+        textArea->setSize(150, 100);
+        REQUIRE(textArea->getMaximumLines() == 0);
+
+        textArea->setMaximumLines(8);
+        REQUIRE(textArea->getMaximumLines() == 8);
+
+        tgui::String appendedText;
+        unsigned int textChangedCount = 0;
+        textArea->onTextAppend([&](const tgui::String& text){ appendedText = text; });
+        textArea->onTextChange([&]{ ++textChangedCount; });
+
+        textArea->addText("Line 0");
+        REQUIRE(appendedText == "Line 0");
+        REQUIRE(textChangedCount == 1);
+
+        for (unsigned int i = 1; i < 8; ++i)
+            textArea->addText("\r\nLine " + tgui::String(i));
+        REQUIRE(appendedText == "\nLine 7");
+        REQUIRE(textChangedCount == 8);
+        REQUIRE(textArea->getLinesCount() == 8);
+        REQUIRE(textArea->getText() == "Line 0\nLine 1\nLine 2\nLine 3\nLine 4\nLine 5\nLine 6\nLine 7");
+        REQUIRE(textArea->getCaretPosition() == textArea->getText().length());
+
+        // Exceeding the limit removes the oldest lines
+        textArea->addText("\nLine 8");
+        REQUIRE(textArea->getLinesCount() == 8);
+        REQUIRE(textArea->getText() == "Line 1\nLine 2\nLine 3\nLine 4\nLine 5\nLine 6\nLine 7\nLine 8");
+        REQUIRE(textArea->getCaretPosition() == textArea->getText().length());
+
+        // Wrapped lines count as multiple lines
+        textArea->addText("\nA long line with enough words to be word-wrapped");
+        REQUIRE(textArea->getLinesCount() == 8);
+        REQUIRE(textArea->getText().ends_with("\nA long line with enough words to be word-wrapped"));
+
+        textArea->setText("1\n2\n3\n4\n5\n6\n7\n8\n9\n10");
+        REQUIRE(textArea->getText() == "3\n4\n5\n6\n7\n8\n9\n10");
+        REQUIRE(textChangedCount == 11);
+
+        // The limit is also applied while typing
+        textArea->setCaretPosition(textArea->getText().length());
+        textArea->textEntered('\n');
+        textArea->textEntered('X');
+        REQUIRE(textArea->getText() == "4\n5\n6\n7\n8\n9\n10\nX");
+        REQUIRE(textArea->getCaretPosition() == textArea->getText().length());
+
+        textArea->setMaximumLines(4);
+        REQUIRE(textArea->getText() == "8\n9\n10\nX");
+        REQUIRE(textArea->getCaretLine() == 4);
+        REQUIRE(textArea->getCaretColumn() == 2);
+
+        // The text passed to onTextChange doesn't contain the removed lines
+        tgui::String changedText;
+        textArea->onTextChange([&](const tgui::String& text){ changedText = text; });
+        textArea->textEntered('\n');
+        textArea->textEntered('Y');
+        REQUIRE(textArea->getText() == "9\n10\nX\nY");
+        REQUIRE(changedText == textArea->getText());
+
+        // Removing the oldest lines doesn't change the word-wrap of the remaining lines
+        auto appendedTextArea = std::make_shared<TextAreaLines>();
+        appendedTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        appendedTextArea->setSize(150, 100);
+        appendedTextArea->setMaximumLines(5);
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            appendedTextArea->addText(((i % 3 == 0) ? "\nA long line with enough words to be word-wrapped " : "\nLine ") + tgui::String(i));
+
+            auto referenceTextArea = std::make_shared<TextAreaLines>();
+            referenceTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            referenceTextArea->setSize(150, 100);
+            referenceTextArea->setText(appendedTextArea->getText());
+            referenceTextArea->setSelectedText(appendedTextArea->getSelectionStart(), appendedTextArea->getSelectionEnd());
+            appendedTextArea->requireSameLines(*referenceTextArea);
+        }
+        REQUIRE(appendedTextArea->getLinesCount() == 5);
+        REQUIRE(appendedTextArea->getText().ends_with("\nLine 49"));
+
+        appendedTextArea->setCaretPosition(0);
+        appendedTextArea->textEntered('X');
+        REQUIRE(appendedTextArea->getText().starts_with("X"));
+        REQUIRE(appendedTextArea->getCaretPosition() == 1);
+
+        textArea->setMaximumLines(0);
+        textArea->addText("\n11\n12\n13");
+        REQUIRE(textArea->getLinesCount() == 7);
+    }
+
     SECTION("ReadOnly")
     {
         SECTION("Changing the read-only state")
@@ -278,6 +388,81 @@ TEST_CASE("[TextArea]")
         REQUIRE(textArea->getLinesCount() == 4);
     }
 
+    SECTION("Editing wrapped text")
+    {
+        textArea->setSize(150, 100);
+        textArea->setText("First paragraph with enough words to wrap\nSecond\nThird paragraph with enough words to wrap");
+        const std::size_t linesCount = textArea->getLinesCount();
+        REQUIRE(linesCount > 3);
+
+        // Only the edited paragraph is wrapped again, the result should be the same as when wrapping the entire text
+        textArea->setCaretPosition(6);
+        const tgui::String insertedText = "and more words ";
+        for (const char32_t c : insertedText)
+            textArea->textEntered(c);
+
+        REQUIRE(textArea->getText() == "First and more words paragraph with enough words to wrap\nSecond\nThird paragraph with enough words to wrap");
+        REQUIRE(textArea->getCaretPosition() == 6 + insertedText.length());
+        REQUIRE(textArea->getLinesCount() > linesCount);
+
+        const std::size_t linesCountAfterTyping = textArea->getLinesCount();
+        textArea->setText(textArea->getText());
+        REQUIRE(textArea->getLinesCount() == linesCountAfterTyping);
+    }
+
+    SECTION("Editing in the middle of the text")
+    {
+        for (const auto policy : {tgui::Scrollbar::Policy::Never, tgui::Scrollbar::Policy::Automatic})
+        {
+            auto editedTextArea = std::make_shared<TextAreaLines>();
+            editedTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            editedTextArea->setSize(150, 100);
+            editedTextArea->setHorizontalScrollbarPolicy(policy);
+            editedTextArea->setText("First paragraph with enough words to wrap\nSecond\nThird paragraph with enough words to wrap\nFourth\nFifth");
+
+            // The lines and selection after each change should be identical to those when word-wrapping the entire text
+            const auto requireSameAsFullRewrap = [&]{
+                auto referenceTextArea = std::make_shared<TextAreaLines>();
+                referenceTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+                referenceTextArea->setSize(150, 100);
+                referenceTextArea->setHorizontalScrollbarPolicy(policy);
+                referenceTextArea->setText(editedTextArea->getText());
+                referenceTextArea->setSelectedText(editedTextArea->getSelectionStart(), editedTextArea->getSelectionEnd());
+                editedTextArea->requireSameLines(*referenceTextArea);
+            };
+
+            // Type in the middle of the third paragraph
+            editedTextArea->setCaretPosition(55);
+            for (const char32_t c : tgui::String("many more words "))
+                editedTextArea->textEntered(c);
+            requireSameAsFullRewrap();
+
+            // Split the paragraph in two
+            editedTextArea->textEntered('\n');
+            requireSameAsFullRewrap();
+
+            // Merge the second and third paragraph
+            editedTextArea->setCaretPosition(49);
+            editedTextArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+            requireSameAsFullRewrap();
+            editedTextArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+            requireSameAsFullRewrap();
+
+            // Shrink the first and widest paragraph
+            editedTextArea->setSelectedText(6, 26);
+            editedTextArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+            requireSameAsFullRewrap();
+
+            // Replace a selection that spans multiple paragraphs
+            editedTextArea->setSelectedText(10, 40);
+            editedTextArea->textEntered('X');
+            requireSameAsFullRewrap();
+
+            editedTextArea->setSelectedText(editedTextArea->getText().length(), 3);
+            requireSameAsFullRewrap();
+        }
+    }
+
     SECTION("TabString")
     {
         REQUIRE(textArea->getTabString() == "\t");
@@ -674,6 +859,7 @@ TEST_CASE("[TextArea]")
         textArea->setText("This is the text in the text box!");
         textArea->setTextSize(25);
         textArea->setMaximumCharacters(16);
+        textArea->setMaximumLines(20);
         textArea->setReadOnly(true);
         textArea->setVerticalScrollbarPolicy(tgui::Scrollbar::Policy::Never);
         textArea->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Always);